@@ -6,6 +6,7 @@ Created on Mon Oct 22 09:43:44 2018
 """
 
 import dnlPython as dnl
+import sys
 
 # Parameters of the model
 nbreSaves = 20
@@ -4914,8 +4915,11 @@ model.createNode(4878, 4.13443708, 10.7679987, 4.13443661)
 model.createNode(4879, 4.14533234, 9.82900047, 4.14533186)
 print("Number of nodes created:", model.getNodesNumber())    
 
-# Creates the Elements
-model.setDefaultElement(dnl.Element.ElHex8N3D)
+# Creates the Elements, another type of hexahedron can be given on the command line
+elementName = 'ElHex8N3D'
+if (len(sys.argv) > 1):
+    elementName = sys.argv[1]
+model.setDefaultElement(getattr(dnl.Element, elementName))
 model.createElement(1, 481, 482, 1837, 1819, 19, 20, 230, 229)
 model.createElement(2, 482, 483, 1838, 1837, 20, 21, 231, 230)
 model.createElement(3, 483, 484, 1839, 1838, 21, 22, 232, 231)
@@ -10117,33 +10121,40 @@ keHist.add(dnl.Field.kineticEnergy)
 keHist.setSaveTime(stopTime / nbrePoints)
 model.add(keHist)
 
-gammaHist = dnl.HistoryFile("gammaHistory")
-gammaHist.setFileName(dnl.String("gamma.plot"))
-gammaHist.add(histES, 1, dnl.Field.gamma)
-gammaHist.add(histES, 2, dnl.Field.gamma)
-gammaHist.add(histES, 3, dnl.Field.gamma)
-gammaHist.add(histES, 4, dnl.Field.gamma)
-gammaHist.setSaveTime(stopTime / nbrePoints)
-model.add(gammaHist)
+hourglassHist = dnl.HistoryFile("hourglassHistory")
+hourglassHist.setFileName(dnl.String("hourglass.plot"))
+hourglassHist.add(dnl.Field.hourglassEnergy)
+hourglassHist.setSaveTime(stopTime / nbrePoints)
+model.add(hourglassHist)
 
-gammaCumulateHist = dnl.HistoryFile("gammaCumulateHistory")
-gammaCumulateHist.setFileName(dnl.String("gammaCumulate.plot"))
-gammaCumulateHist.add(histES, 1, dnl.Field.gammaCumulate)
-gammaCumulateHist.add(histES, 2, dnl.Field.gammaCumulate)
-gammaCumulateHist.add(histES, 3, dnl.Field.gammaCumulate)
-gammaCumulateHist.add(histES, 4, dnl.Field.gammaCumulate)
-gammaCumulateHist.setSaveTime(stopTime / nbrePoints)
-model.add(gammaCumulateHist)
+# Histories at the integration points 1 to 4, only available with the fully integrated element
+if (elementName == 'ElHex8N3D'):
+    gammaHist = dnl.HistoryFile("gammaHistory")
+    gammaHist.setFileName(dnl.String("gamma.plot"))
+    gammaHist.add(histES, 1, dnl.Field.gamma)
+    gammaHist.add(histES, 2, dnl.Field.gamma)
+    gammaHist.add(histES, 3, dnl.Field.gamma)
+    gammaHist.add(histES, 4, dnl.Field.gamma)
+    gammaHist.setSaveTime(stopTime / nbrePoints)
+    model.add(gammaHist)
 
-# Declaration of the history files
-vonMisesHist2 = dnl.HistoryFile("vonMisesHistory2")
-vonMisesHist2.setFileName(dnl.String("vonMises2.plot"))
-vonMisesHist2.add(histES, 1, dnl.Field.vonMises)
-vonMisesHist2.add(histES, 2, dnl.Field.vonMises)
-vonMisesHist2.add(histES, 3, dnl.Field.vonMises)
-vonMisesHist2.add(histES, 4, dnl.Field.vonMises)
-vonMisesHist2.setSaveTime(stopTime / nbrePoints)
-model.add(vonMisesHist2)
+    gammaCumulateHist = dnl.HistoryFile("gammaCumulateHistory")
+    gammaCumulateHist.setFileName(dnl.String("gammaCumulate.plot"))
+    gammaCumulateHist.add(histES, 1, dnl.Field.gammaCumulate)
+    gammaCumulateHist.add(histES, 2, dnl.Field.gammaCumulate)
+    gammaCumulateHist.add(histES, 3, dnl.Field.gammaCumulate)
+    gammaCumulateHist.add(histES, 4, dnl.Field.gammaCumulate)
+    gammaCumulateHist.setSaveTime(stopTime / nbrePoints)
+    model.add(gammaCumulateHist)
+
+    vonMisesHist2 = dnl.HistoryFile("vonMisesHistory2")
+    vonMisesHist2.setFileName(dnl.String("vonMises2.plot"))
+    vonMisesHist2.add(histES, 1, dnl.Field.vonMises)
+    vonMisesHist2.add(histES, 2, dnl.Field.vonMises)
+    vonMisesHist2.add(histES, 3, dnl.Field.vonMises)
+    vonMisesHist2.add(histES, 4, dnl.Field.vonMises)
+    vonMisesHist2.setSaveTime(stopTime / nbrePoints)
+    model.add(vonMisesHist2)
 
 # Parallel computation
 model.parallel.setCores(4)
@@ -0,0 +1,20 @@
+# Global parameters
+Parameters, xrange=7, xname=$Elongation\ of\ the\ end\ of\ the\ bar\ (mm)$, marksnumber=15, title=$Bar\ Necking\ Kinematics\ Test$, crop=True
+
+# Temperature curve
+temperature, yname=$Temperature\ (^{\circ}C)$, legendlocate=bottomright, name=$Hughes-Winget\ T$, temperature.plot, name=$Polar\ T$, Polar/temperature.plot
+
+# Plastic strain curve
+plasticStrain, yname=$Equivalent\ plastic\ strain\ \overline{\varepsilon}^{p}$, legendlocate=bottomright, name=$Hughes-Winget\ \overline{\varepsilon}^{p}$, plasticStrain.plot, name=$Polar\ \overline{\varepsilon}^{p}$, Polar/plasticStrain.plot
+
+# von Mises equivalent stress curve
+vonMises, yname=$von\ Mises\ stress\ \overline{\sigma}\ (MPa)$, legendlocate=topright, name=$Hughes-Winget\ \overline{\sigma}$, vonMises.plot, name=$Polar\ \overline{\sigma}$, Polar/vonMises.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$Hughes-Winget\ \Delta t$, dt.plot, name=$Polar\ \Delta t$, Polar/dt.plot
+
+# Kinetic energy curve
+kineticEnergy, yname=$Kinetic\ energy$, legendlocate=bottomright, name=$Hughes-Winget\ Kinetic\ Energy$, ke.plot, name=$Polar\ Kinetic\ Energy$, Polar/ke.plot
+
+# Radius history
+radius, yname=$Radius\ R_f\ (mm)$, legendlocate=topright, name=$Hughes-Winget\ R_f$, radius.plot, name=$Polar\ R_f$, Polar/radius.plot
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 17:48:26 2026
+
+@author: pantale
+"""
+
+import dnlBench
+import dnlCurves as cu
+import os
+import subprocess
+import numpy as np
+
+# The model is computed with the polar decomposition kinematics in the Polar directory, then with the Hughes-Winget kinematics
+# The history files of the Hughes-Winget kinematics must stay within 1% of the ones of the polar decomposition
+class KinematicsBenchmark(dnlBench.Benchmark):
+    def runBench(self):
+        print("Run the " + self.Benchmark + " benchmark with the polar decomposition kinematics\n")
+        os.makedirs('Polar', exist_ok=True)
+        subprocess.run("python3 ../" + self.Benchmark + ".py PolarDecomposition", shell=True, check=True, cwd='Polar')
+        print("Run the " + self.Benchmark + " benchmark with the Hughes-Winget kinematics\n")
+        subprocess.run("python3 " + self.Benchmark + ".py HughesWinget", shell=True, check=True)
+        for file in self.files:
+            data1 = np.genfromtxt(file)
+            data0 = np.genfromtxt('Polar/' + file)
+            if ((np.abs(data1[:, 1] - np.interp(data1[:, 0], data0[:, 0], data0[:, 1]))).max() > 1e-2 * (np.abs(data0[:, 1])).max()):
+                print("Results of the Hughes-Winget and polar decomposition kinematics differ in result file " + file + "\n")
+                return 1
+        # Plot the results of the two kinematics as curves
+        curves = cu.Curves()
+        curves.plotFile('Curves.ex')
+        return 0
+
+test = KinematicsBenchmark('Kinematics')  
+test.setPlotFiles(['temperature.plot', 'vonMises.plot', 'plasticStrain.plot', 'radius.plot'])
+test.setTolerance(1e-1)
+test.run()
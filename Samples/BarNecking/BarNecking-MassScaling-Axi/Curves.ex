@@ -0,0 +1,26 @@
+# Global parameters
+Parameters, xrange=7, xname=$Elongation\ of\ the\ end\ of\ the\ bar\ (mm)$, marksnumber=15, title=$Bar\ Necking\ Mass\ Scaling\ Test$, crop=True
+
+# Temperature curve
+temperature, yname=$Temperature\ (^{\circ}C)$, legendlocate=bottomright, name=$Mass\ scaling\ T$, temperature.plot, name=$No\ scaling\ T$, NoScaling/temperature.plot
+
+# Plastic strain curve
+plasticStrain, yname=$Equivalent\ plastic\ strain\ \overline{\varepsilon}^{p}$, legendlocate=bottomright, name=$Mass\ scaling\ \overline{\varepsilon}^{p}$, plasticStrain.plot, name=$No\ scaling\ \overline{\varepsilon}^{p}$, NoScaling/plasticStrain.plot
+
+# von Mises equivalent stress curve
+vonMises, yname=$von\ Mises\ stress\ \overline{\sigma}\ (MPa)$, legendlocate=topright, name=$Mass\ scaling\ \overline{\sigma}$, vonMises.plot, name=$No\ scaling\ \overline{\sigma}$, NoScaling/vonMises.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$Mass\ scaling\ \Delta t$, dt.plot, name=$No\ scaling\ \Delta t$, NoScaling/dt.plot
+
+# Kinetic energy curve
+kineticEnergy, yname=$Kinetic\ energy$, legendlocate=bottomright, name=$Mass\ scaling\ Kinetic\ Energy$, ke.plot, name=$No\ scaling\ Kinetic\ Energy$, NoScaling/ke.plot
+
+# Radius history
+radius, yname=$Radius\ R_f\ (mm)$, legendlocate=topright, name=$Mass\ scaling\ R_f$, radius.plot, name=$No\ scaling\ R_f$, NoScaling/radius.plot
+
+# Added mass history
+addedMass, yname=$Added\ mass$, legendlocate=topleft, name=$Added\ mass$, addedMass.plot
+
+# Kinetic energy ratio history
+kineticEnergyRatio, yname=$Kinetic\ to\ internal\ energy\ ratio$, legendlocate=topright, name=$Mass\ scaling\ ratio$, keRatio.plot, name=$No\ scaling\ ratio$, NoScaling/keRatio.plot
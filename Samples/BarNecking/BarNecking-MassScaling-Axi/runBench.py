@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 17:05:12 2026
+
+@author: pantale
+"""
+
+import dnlBench
+import dnlCurves as cu
+import os
+import subprocess
+import numpy as np
+
+# The model is computed without mass scaling in the NoScaling directory, then with a 4e-8 s target time step
+# Only the elements distorted by the necking are scaled, the history files must stay within 1% of the ones without mass scaling
+# and the kinetic energy must stay below 1% of the internal energy once the bar is loaded, so that the computation remains quasi-static
+# Larger targets also scale the smaller elements of the lower half of the bar, with a 6e-8 s target the necking moves away from the bottom of the bar
+class MassScalingBenchmark(dnlBench.Benchmark):
+    def runBench(self):
+        print("Run the " + self.Benchmark + " benchmark without mass scaling\n")
+        os.makedirs('NoScaling', exist_ok=True)
+        subprocess.run("python3 ../" + self.Benchmark + ".py", shell=True, check=True, cwd='NoScaling')
+        print("Run the " + self.Benchmark + " benchmark with mass scaling\n")
+        subprocess.run("python3 " + self.Benchmark + ".py 4e-8", shell=True, check=True)
+        for file in self.files:
+            data1 = np.genfromtxt(file)
+            data0 = np.genfromtxt('NoScaling/' + file)
+            if ((np.abs(data1[:, 1] - np.interp(data1[:, 0], data0[:, 0], data0[:, 1]))).max() > 1e-2 * (np.abs(data0[:, 1])).max()):
+                print("Results with and without mass scaling differ in result file " + file + "\n")
+                return 1
+        ratio = np.genfromtxt('keRatio.plot')
+        if (ratio[ratio[:, 0] > 1e-4, 1].max() > 1e-2):
+            print("The kinetic energy ratio exceeds 1% with mass scaling\n")
+            return 1
+        # Plot the results with and without mass scaling as curves
+        curves = cu.Curves()
+        curves.plotFile('Curves.ex')
+        return 0
+
+test = MassScalingBenchmark('MassScaling')  
+test.setPlotFiles(['temperature.plot', 'vonMises.plot', 'plasticStrain.plot', 'radius.plot'])
+test.setTolerance(1e-1)
+test.run()
@@ -0,0 +1,20 @@
+# Global parameters
+Parameters, xrange=7, xname=$Elongation\ of\ the\ end\ of\ the\ bar\ (mm)$, marksnumber=15, title=$Bar\ Necking\ Reduced\ Integration\ Test$, crop=True
+
+# Temperature curve
+temperature, yname=$Temperature\ (^{\circ}C)$, legendlocate=bottomright, name=$ElHex8N3DR\ T$, temperature.plot, name=$ElHex8N3D\ T$, ../BarNecking-3D/temperature.plot
+
+# Plastic strain curve
+plasticStrain, yname=$Equivalent\ plastic\ strain\ \overline{\varepsilon}^{p}$, legendlocate=bottomright, name=$ElHex8N3DR\ \overline{\varepsilon}^{p}$, plasticStrain.plot, name=$ElHex8N3D\ \overline{\varepsilon}^{p}$, ../BarNecking-3D/plasticStrain.plot
+
+# von Mises equivalent stress curve
+vonMises, yname=$von\ Mises\ stress\ \overline{\sigma}\ (MPa)$, legendlocate=topright, name=$ElHex8N3DR\ \overline{\sigma}$, vonMises.plot, name=$ElHex8N3D\ \overline{\sigma}$, ../BarNecking-3D/vonMises.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$ElHex8N3DR\ \Delta t$, dt.plot, name=$ElHex8N3D\ \Delta t$, ../BarNecking-3D/dt.plot
+
+# Kinetic energy curve
+kineticEnergy, yname=$Kinetic\ energy$, legendlocate=bottomright, name=$ElHex8N3DR\ Kinetic\ Energy$, ke.plot, name=$ElHex8N3D\ Kinetic\ Energy$, ../BarNecking-3D/ke.plot
+
+# Hourglass energy curve
+hourglassEnergy, yname=$Energy$, legendlocate=topleft, name=$ElHex8N3DR\ Hourglass\ Energy$, hourglass.plot, name=$ElHex8N3DR\ Kinetic\ Energy$, ke.plot
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 16:20:37 2026
+
+@author: pantale
+"""
+
+import dnlBench
+import os
+import subprocess
+import numpy as np
+
+# The bar of the BarNecking-3D sample is computed with the reduced integration ElHex8N3DR element
+# The reference is the BarNecking-3D sample with the fully integrated ElHex8N3D element, computed first if its results are missing
+# The final values of the history files must stay within 5% of the reference ones
+class ReducedBenchmark(dnlBench.Benchmark):
+    def runBench(self):
+        reference = '../BarNecking-3D/'
+        if (not all(os.path.exists(reference + file) for file in self.files)):
+            print("Run the BarNecking-3D benchmark with the ElHex8N3D element\n")
+            subprocess.run("python3 BarNecking.py", shell=True, check=True, cwd=reference)
+        print("Run the " + self.Benchmark + " benchmark with the ElHex8N3DR element\n")
+        subprocess.run("python3 " + reference + self.Benchmark + ".py ElHex8N3DR", shell=True, check=True)
+        for file in self.files:
+            data1 = np.genfromtxt(file)
+            data0 = np.genfromtxt(reference + file)
+            if (np.abs(data1[-1, 1] - data0[-1, 1]) > 0.05 * np.abs(data0[-1, 1])):
+                print("Final value of the ElHex8N3DR and ElHex8N3D elements differ in result file " + file + "\n")
+                return 1
+        return 0
+
+test = ReducedBenchmark('BarNecking')  
+test.setPlotFiles(['temperature.plot', 'vonMises.plot', 'plasticStrain.plot'])
+test.setTolerance(1e-1)
+test.run()
@@ -0,0 +1,8 @@
+# Global parameters
+Parameters, xname=$Tensor\ number$, marksnumber=15, title=$Closed\ form\ vs\ Jacobi\ polar\ decomposition$, crop=True
+
+# Difference on the logarithmic strain
+errorLnU, yname=$Difference\ on\ \ln U$, legendlocate=topright, name=$\|\ln U-\ln U_{Jacobi}\|$, errors.plot[0:1]
+
+# Difference on the rotation
+errorR, yname=$Difference\ on\ R$, legendlocate=topright, name=$\|R-R_{Jacobi}\|$, errors.plot[0:2]
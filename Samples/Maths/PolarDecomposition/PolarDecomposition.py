@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 10:12:05 2026
+
+@author: pantale
+"""
+
+# Import the DynELA Python interpreter
+import dnlPython as dnl
+import math
+import sys
+
+nbreTests = 200     # nombre de tenseurs F testés
+tolerance = 1e-8    # écart maximum admis entre les deux méthodes
+
+# Rotation tensor of a given angle around the axis number axis
+def rotation(axis, angle):
+    c = math.cos(angle)
+    s = math.sin(angle)
+    if (axis == 0):
+        return dnl.Tensor2(1, 0, 0, 0, c, -s, 0, s, c)
+    if (axis == 1):
+        return dnl.Tensor2(c, 0, s, 0, 1, 0, -s, 0, c)
+    return dnl.Tensor2(c, -s, 0, s, c, 0, 0, 0, 1)
+
+# Symmetric part of a Tensor2 stored in a SymTensor2
+def symmetric(T):
+    return dnl.SymTensor2(T[0, 0], 0.5 * (T[0, 1] + T[1, 0]), 0.5 * (T[0, 2] + T[2, 0]), T[1, 1], 0.5 * (T[1, 2] + T[2, 1]), T[2, 2])
+
+# Gradients of deformation F = Rt.U with U = Q.D.Q^T are built from known rotations and stretches
+# One tensor out of three is a plane tensor (polarDecomposeLnU2D), some of them have coincident stretches
+maxErrorLnU = 0
+maxErrorR = 0
+maxErrorExact = 0
+plotFile = open('errors.plot', 'w')
+plotFile.write('#index errorLnU errorR errorExact\n')
+for k in range(nbreTests):
+    plane = (k % 3 == 0)
+    l1 = 1 + 0.3 * math.sin(1.3 * k + 0.2)
+    l2 = 1 + 0.3 * math.sin(2.1 * k + 0.7)
+    l3 = 1 + 0.3 * math.sin(0.7 * k + 1.1)
+    if (k % 5 == 0):
+        l2 = l1
+    if (k % 7 == 0):
+        l2 = l1
+        l3 = l1
+    if (plane):
+        Q = rotation(2, 0.53 * k)
+        Rt = rotation(2, 0.37 * k - 1.0)
+    else:
+        Q = rotation(0, 0.11 * k + 0.3) * rotation(2, 0.53 * k)
+        Rt = rotation(2, 0.37 * k - 1.0) * rotation(1, 0.29 * k + 0.1)
+    U = Q * dnl.Tensor2(l1, 0, 0, 0, l2, 0, 0, 0, l3) * Q.getTranspose()
+    LnUt = symmetric(Q * dnl.Tensor2(math.log(l1), 0, 0, 0, math.log(l2), 0, 0, 0, math.log(l3)) * Q.getTranspose())
+    F = Rt * U
+
+    # Closed form polar decomposition
+    LnU = dnl.SymTensor2()
+    R = dnl.Tensor2()
+    F.polarDecomposeLnU(LnU, R)
+
+    # Jacobi iterative polar decomposition
+    LnUJ = dnl.SymTensor2()
+    RJ = dnl.Tensor2()
+    F.polarDecomposeLnUJacobi(LnUJ, RJ)
+
+    errorLnU = (LnU - LnUJ).getNorm()
+    errorR = (R - RJ).getNorm()
+    errorExact = max((LnU - LnUt).getNorm(), (R - Rt).getNorm())
+    plotFile.write('%d %g %g %g\n' % (k, errorLnU, errorR, errorExact))
+    maxErrorLnU = max(maxErrorLnU, errorLnU)
+    maxErrorR = max(maxErrorR, errorR)
+    maxErrorExact = max(maxErrorExact, errorExact)
+plotFile.close()
+
+print("Maximum difference on ln[U] between closed form and Jacobi:", maxErrorLnU)
+print("Maximum difference on R between closed form and Jacobi:", maxErrorR)
+print("Maximum error of the closed form:", maxErrorExact)
+
+if (max(maxErrorLnU, maxErrorR, maxErrorExact) > tolerance):
+    print("Closed form and Jacobi polar decompositions differ")
+    sys.exit(1)
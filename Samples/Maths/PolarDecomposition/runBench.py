@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 10:12:05 2026
+
+@author: pantale
+"""
+
+import dnlBench
+
+test = dnlBench.Benchmark('PolarDecomposition')  
+test.setPlotFiles(['errors.plot'])
+test.setTolerance(1e-8)
+test.run()
@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 11:34:48 2026
+
+@author: pantale
+"""
+
+import dnlBench
+
+test = dnlBench.Benchmark('Birth')  
+test.setPlotFiles(['height.plot', 'radius.plot', 'ke.plot'])
+test.setTolerance(1e-1)
+test.run()
@@ -0,0 +1,17 @@
+# Global parameters
+Parameters, xname=$Time\ (s)$, marksnumber=15, title=$Taylor\ Axi\ Contact\ Test$, crop=True
+
+# Kinetic energy curve
+kineticEnergy, yname=$Kinetic\ energy$, legendlocate=topright, name=$DynELA\ Kinetic\ Energy$, ke.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$DynELA\ \Delta t$, dt.plot
+
+# Height history
+height, yname=$Height\ H_f\ (mm)$, name=$DynELA\ H_f$, height.plot
+
+# Radius history
+radius, yname=$Radius\ R_f\ (mm)$, name=$DynELA\ R_f$, legendlocate=bottomright, radius.plot
+
+# Anvil surface history
+anvil, yname=$Anvil\ surface\ (mm)$, name=$DynELA\ Y_a$, legendlocate=topright, anvil.plot
@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 11:02:37 2026
+
+@author: pantale
+"""
+
+import dnlBench
+
+test = dnlBench.Benchmark('Contact')  
+test.setPlotFiles(['height.plot', 'radius.plot', 'anvil.plot'])
+test.setTolerance(1e-1)
+test.run()
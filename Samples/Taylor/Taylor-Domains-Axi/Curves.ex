@@ -0,0 +1,20 @@
+# Global parameters
+Parameters, xname=$Time\ (s)$, marksnumber=15, title=$Taylor\ Axi\ Domains\ Test$, crop=True
+
+# Temperature curve
+temperature, yname=$Temperature\ (^{\circ}C)$, legendlocate=bottomright, name=$2\ domains\ T$, temperature.plot, name=$1\ domain\ T$, np1/temperature.plot
+
+# Plastic strain curve
+plasticStrain, yname=$Equivalent\ plastic\ strain\ \overline{\varepsilon}^{p}$, legendlocate=bottomright, name=$2\ domains\ \overline{\varepsilon}^{p}$, plasticStrain.plot, name=$1\ domain\ \overline{\varepsilon}^{p}$, np1/plasticStrain.plot
+
+# von Mises equivalent stress curve
+vonMises, yname=$von\ Mises\ stress\ \overline{\sigma}\ (MPa)$, legendlocate=topright, name=$2\ domains\ \overline{\sigma}$, vonMises.plot, name=$1\ domain\ \overline{\sigma}$, np1/vonMises.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$2\ domains\ \Delta t$, dt.plot, name=$1\ domain\ \Delta t$, np1/dt.plot
+
+# Height history
+height, yname=$Height\ H_f\ (mm)$, name=$2\ domains\ H_f$, height.plot, name=$1\ domain\ H_f$, np1/height.plot
+
+# Radius history
+radius, yname=$Radius\ R_f\ (mm)$, name=$2\ domains\ R_f$, legendlocate=bottomright, radius.plot, name=$1\ domain\ R_f$, np1/radius.plot
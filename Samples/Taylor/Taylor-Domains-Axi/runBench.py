@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 12:15:41 2026
+
+@author: pantale
+"""
+
+import dnlBench
+import dnlCurves as cu
+import os
+import subprocess
+import numpy as np
+
+# The model is computed with 1 MPI process in the np1 directory, then with 2 MPI processes
+# The history files must not depend on the number of domains
+class DomainsBenchmark(dnlBench.Benchmark):
+    def runBench(self):
+        print("Run the " + self.Benchmark + " benchmark on 1 domain\n")
+        os.makedirs('np1', exist_ok=True)
+        subprocess.run("mpirun -np 1 python3 ../" + self.Benchmark + ".py", shell=True, check=True, cwd='np1')
+        print("Run the " + self.Benchmark + " benchmark on 2 domains\n")
+        subprocess.run("mpirun -np 2 python3 " + self.Benchmark + ".py", shell=True, check=True)
+        for file in self.files:
+            data1 = np.genfromtxt(file)
+            data0 = np.genfromtxt('np1/' + file)
+            if ((np.abs(data1-data0)).max() > 1e-6 * (np.abs(data0)).max()):
+                print("Results of 1 and 2 domains differ in result file " + file + "\n")
+                return 1
+        # Plot the results of 1 and 2 domains as curves
+        curves = cu.Curves()
+        curves.plotFile('Curves.ex')
+        return 0
+
+test = DomainsBenchmark('Domains')  
+test.setPlotFiles(['temperature.plot', 'vonMises.plot', 'plasticStrain.plot', 'radius.plot', 'height.plot', 'dt.plot', 'ke.plot'])
+test.setTolerance(1e-1)
+test.run()
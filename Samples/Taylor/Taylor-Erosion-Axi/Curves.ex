@@ -0,0 +1,14 @@
+# Global parameters
+Parameters, xname=$Time\ (s)$, marksnumber=15, title=$Taylor\ Axi\ Erosion\ Test$, crop=True
+
+# Kinetic energy curve
+kineticEnergy, yname=$Kinetic\ energy$, legendlocate=topright, name=$DynELA\ Kinetic\ Energy$, ke.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$DynELA\ \Delta t$, dt.plot
+
+# Height history
+height, yname=$Height\ H_f\ (mm)$, name=$DynELA\ H_f$, height.plot
+
+# Radius history
+radius, yname=$Radius\ R_f\ (mm)$, name=$DynELA\ R_f$, legendlocate=bottomright, radius.plot
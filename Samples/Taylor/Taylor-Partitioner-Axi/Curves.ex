@@ -0,0 +1,20 @@
+# Global parameters
+Parameters, xname=$Time\ (s)$, marksnumber=15, title=$Taylor\ Axi\ Partitioner\ Test$, crop=True
+
+# Temperature curve
+temperature, yname=$Temperature\ (^{\circ}C)$, legendlocate=bottomright, name=$Bisection\ T$, temperature.plot, name=$RoundRobin\ T$, RoundRobin/temperature.plot, name=$Hilbert\ T$, Hilbert/temperature.plot
+
+# Plastic strain curve
+plasticStrain, yname=$Equivalent\ plastic\ strain\ \overline{\varepsilon}^{p}$, legendlocate=bottomright, name=$Bisection\ \overline{\varepsilon}^{p}$, plasticStrain.plot, name=$RoundRobin\ \overline{\varepsilon}^{p}$, RoundRobin/plasticStrain.plot, name=$Hilbert\ \overline{\varepsilon}^{p}$, Hilbert/plasticStrain.plot
+
+# von Mises equivalent stress curve
+vonMises, yname=$von\ Mises\ stress\ \overline{\sigma}\ (MPa)$, legendlocate=topright, name=$Bisection\ \overline{\sigma}$, vonMises.plot, name=$RoundRobin\ \overline{\sigma}$, RoundRobin/vonMises.plot, name=$Hilbert\ \overline{\sigma}$, Hilbert/vonMises.plot
+
+# TimeStep curve
+timeStep, yname=$Time\ increment\ \Delta t\ (s)$, legendlocate=topright, name=$Bisection\ \Delta t$, dt.plot, name=$RoundRobin\ \Delta t$, RoundRobin/dt.plot, name=$Hilbert\ \Delta t$, Hilbert/dt.plot
+
+# Height history
+height, yname=$Height\ H_f\ (mm)$, name=$Bisection\ H_f$, height.plot, name=$RoundRobin\ H_f$, RoundRobin/height.plot, name=$Hilbert\ H_f$, Hilbert/height.plot
+
+# Radius history
+radius, yname=$Radius\ R_f\ (mm)$, legendlocate=bottomright, name=$Bisection\ R_f$, radius.plot, name=$RoundRobin\ R_f$, RoundRobin/radius.plot, name=$Hilbert\ R_f$, Hilbert/radius.plot
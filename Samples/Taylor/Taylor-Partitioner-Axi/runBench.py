@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 15:02:27 2026
+
+@author: pantale
+"""
+
+import dnlBench
+import dnlCurves as cu
+import os
+import subprocess
+import numpy as np
+
+# The model is computed with the RoundRobin and Hilbert partitioners in their own directories, then with the Bisection partitioner
+# The history files must not depend on the partitioner of the elements on the cores
+class PartitionerBenchmark(dnlBench.Benchmark):
+    def runBench(self):
+        for partitioner, name in [(0, 'RoundRobin'), (2, 'Hilbert')]:
+            print("Run the " + self.Benchmark + " benchmark with the " + name + " partitioner\n")
+            os.makedirs(name, exist_ok=True)
+            subprocess.run("python3 ../" + self.Benchmark + ".py " + str(partitioner), shell=True, check=True, cwd=name)
+        print("Run the " + self.Benchmark + " benchmark with the Bisection partitioner\n")
+        subprocess.run("python3 " + self.Benchmark + ".py 1", shell=True, check=True)
+        for file in self.files:
+            data1 = np.genfromtxt(file)
+            for name in ['RoundRobin', 'Hilbert']:
+                data0 = np.genfromtxt(name + '/' + file)
+                if ((np.abs(data1-data0)).max() > 1e-10 * (np.abs(data0)).max()):
+                    print("Results of the Bisection and " + name + " partitioners differ in result file " + file + "\n")
+                    return 1
+        # Plot the results of the three partitioners as curves
+        curves = cu.Curves()
+        curves.plotFile('Curves.ex')
+        return 0
+
+test = PartitionerBenchmark('Partitioner')  
+test.setPlotFiles(['temperature.plot', 'vonMises.plot', 'plasticStrain.plot', 'radius.plot', 'height.plot', 'dt.plot', 'ke.plot'])
+test.setTolerance(1e-1)
+test.run()
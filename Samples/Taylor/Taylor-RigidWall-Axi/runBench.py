@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Created on Sat Oct 17 11:52:20 2026
+
+@author: pantale
+"""
+
+import dnlBench
+
+test = dnlBench.Benchmark('RigidWall')  
+test.setPlotFiles(['temperature.plot', 'vonMises.plot', 'plasticStrain.plot'])
+test.setTolerance(1e-1)
+test.run()
@@ -0,0 +1,50 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file ElHex8N3DR.h
+  \brief Declaration file for the ElHex8N3DR class
+
+  This file is the declaration file for the ElHex8N3DR class, the 8 nodes hexahedron with one point reduced integration and hourglass control.
+  \ingroup dnlElements
+*/
+
+#ifndef __dnlElements_ElHex8N3DR_h__
+#define __dnlElements_ElHex8N3DR_h__
+
+#include <ElHex8N3D.h>
+
+/*!
+  \brief 8 nodes hexahedron with reduced integration
+
+  This element uses a single integration point at the center of the element. The spurious zero energy modes (hourglass modes) are controlled by the Flanagan-Belytschko viscous and stiffness hourglass forces, the coefficients of which are given by the hourglassViscosity and hourglassStiffness parameters of the material. The energy dissipated by the hourglass forces is accumulated in the element and can be recovered with getHourglassEnergy().
+  \ingroup dnlElements
+*/
+class ElHex8N3DR : public ElHex8N3D
+{
+  double _hourglassStress[4][3]; // Stiffness part of the generalized hourglass forces
+  double _hourglassEnergy;       // Work of the hourglass forces
+
+public:
+  static const ElementData _elementData;
+
+public:
+  // constructeurs
+  ElHex8N3DR(long elementNumber = 1);
+  ElHex8N3DR(const ElHex8N3DR &el);
+  ~ElHex8N3DR();
+
+  void computeHourglassForces(double *forces, double timeStep);
+  void computeInternalForces(Vector &F, double timeStep);
+  double getHourglassEnergy();
+};
+
+#endif
@@ -37,7 +37,7 @@ class Element
     Vec3D _nodeMin, _nodeMax;          // Bounding box of an element.
 
 protected:
-    Matrix _globalToLocal;
+    Mat<3, 4> _globalToLocal;
     const ElementData *_elementData;
     IntegrationPoint *_integrationPoint;
     UnderIntegrationPoint *_underIntegrationPoint;
@@ -48,7 +48,11 @@ public:
     ListIndex<Node *> nodes;
     long number;
     Material *material;
-    Matrix stiffnessMatrix;
+    short timeStepClass = 0; // Time step class of the element for the subcycling
+    double massScaling = 1.0; // Scaling factor of the density of the element for the mass scaling
+    double courantTimeStep = 0.0; // Courant time step of the element, updated with the Jacobian
+    double eigenvalueTimeStep = 0.0; // Time step from the bound of the maximum eigenvalue of the element, updated with the Jacobian
+    bool active = true; // The element is neither eroded nor waiting for its birth, see Model::updateActiveElements()
 
     enum
     {
@@ -58,7 +62,8 @@ public:
         ElQua4NAx,
         ElHex8N3D,
         ElTet4N3D,
-        ElTet10N3D
+        ElTet10N3D,
+        ElHex8N3DR
     };
 
     //#ifndef SWIG
@@ -70,6 +75,13 @@ public:
     };
     //#endif
 
+    // Kinematics of the computation of the strain increments, see computeStrains()
+    enum
+    {
+        PolarDecomposition = 0,
+        HughesWinget
+    };
+
 public:
     Element(long elementNumber = 1);
     Element(const Element &element);
@@ -87,8 +99,10 @@ public:
     bool operator>(const Element &) const;
 
     bool check();
+    bool checkErosion(double maximumPlasticStrain, double minimumTimeStep, double minimumVolumeRatio);
     //double getDensityAtIntegrationPoint(short time);
     double getElongationWaveSpeed();
+    virtual double getHourglassEnergy();
     double getIntPointValue(short field, short intPoint);
     IntegrationPoint *getIntegrationPoint(short point);
     UnderIntegrationPoint *getUnderIntegrationPoint(short point);
@@ -125,16 +139,16 @@ public:
     void add(UnderIntegrationPoint *_integrationPoint, short intPointId);
     void addNode(Node *newNode);
     //void computeConstitutiveEquation();
+    void computeCriticalTimeSteps();
     void computeFinalRotation();
-    void computeInternalForces(Vector &F, double timeStep);
+    virtual void computeInternalForces(Vector &F, double timeStep);
     //void computeMassEquation(MatrixDiag &M, Vector &F);
     void computeMassMatrix(MatrixDiag &massMatrix);
     //void computeMomentumEquation(MatrixDiag &M, Vector &F);
     void computePressure();
     //  void computeStateEquationOld();
-    void computeStrains();
+    void computeStrains(short kinematics = PolarDecomposition);
     //  void computeStrainsOld(double);
-    void computeStress(double timeStep);
     void computeStressDirect(double timeStep);
     //  void computeStressOld(double timeStep);
     void createIntegrationPoints();
@@ -146,7 +160,7 @@ public:
     Node *getNodeOnFace(short face, short node);
     const ElementData *getElementData() const;
     void dumpElementData() const;
-    virtual void computeElasticStiffnessMatrix(bool underIntegration = false) = 0;
+    virtual void computeElasticStiffnessProduct(const double *vector, double *product, bool underIntegration = false) = 0;
     virtual double getRadiusAtUnderIntegrationPoint()=0;
 
     /*   
@@ -45,7 +45,7 @@ public:
   bool checkLevel2();
   void getV_atIntPoint(Vec3D &v, short time);
   void getdV_atIntPoint(Tensor2 &dv, short time);
-  void computeElasticStiffnessMatrix(bool underIntegration = false);
+  void computeElasticStiffnessProduct(const double *vector, double *product, bool underIntegration = false);
 
   /*   long numberOfUnderIntegrationPoints () = 0;
   double getVolume () = 0;
@@ -26,7 +26,6 @@ This file is the declaration file for the ElementData class.
 #define maxNumberOfEdges 12                 //!< Maximum number of edges for the elements
 #define maxNumberOfFaces 6                  //!< Maximum number of faces for the elements
 #define maxNumberOfIntegrationPoints 8      //!< Maximum number of integration points for the elements
-#define maxNumberOfNodes 10                 //!< Maximum number of nodes for the elements
 #define maxNumberOfNodesByFace 6            //!< Maximum number of nodes by face for the elements
 #define maxNumberOfNodesNeighbour 3         //!< Maximum number of neighbour nodes for the elements
 #define maxNumberOfUnderIntegrationPoints 1 //!< Maximum number of under integration points for the elements
@@ -53,7 +52,7 @@ struct IntegrationPointData
     Vec3D coords;            //!< Coordinates of the integration point
     double weight;           //!< Weight associated to the integration point
     Vector shapeFunction;    //!< Shape functions at the integration point
-    Matrix derShapeFunction; //!< Derivatives of the shape functions at the integration point
+    Mat<maxNumberOfNodes, 3> derShapeFunction; //!< Derivatives of the shape functions at the integration point
 };
 
 /*!
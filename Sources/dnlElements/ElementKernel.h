@@ -0,0 +1,265 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file ElementKernel.h
+  \brief Declaration file for the specialized element kernels
+
+  This file declares the element kernels specialized at compile time for each type of element. The number of nodes, the number of dimensions, the number of integration points and the axisymmetric flag are template parameters, so that all loops have constant bounds and can be fully unrolled by the compiler, and no virtual method is called inside the kernels.
+  The ElementBatch class dispatches a batch of elements of the same type to the corresponding kernel, the test on the type of the element is done only once per batch.
+  \ingroup dnlElements
+*/
+
+#ifndef __dnlElements_ElementKernel_h__
+#define __dnlElements_ElementKernel_h__
+
+#include <Element.h>
+#include <Node.h>
+
+/*!
+  \brief Element kernels specialized for a given type of element
+  \ingroup dnlElements
+*/
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+class ElementKernel
+{
+public:
+  static const int numberOfIntegrationPoints = nIntPts;
+
+public:
+  static bool computeJacobian(Element *element, bool reference);
+  static void computeStrains(Element *element, short kinematics);
+  static void computeElementForces(Element *element, double *elementForces);
+  static void assembleElementForces(Element *element, const double *elementForces, Vector &internalForces);
+  static void computeInternalForces(Element *element, Vector &internalForces, double timeStep);
+  static void computeDensity(Element *element);
+};
+
+// Kernels of the elements of the library
+typedef ElementKernel<8, 3, 8, false> Hex8N3DKernel;
+typedef ElementKernel<4, 3, 1, false> Tet4N3DKernel;
+typedef ElementKernel<10, 3, 4, false> Tet10N3DKernel;
+typedef ElementKernel<4, 2, 4, false> Qua4N2DKernel;
+typedef ElementKernel<3, 2, 1, false> Tri3N2DKernel;
+typedef ElementKernel<4, 2, 4, true> Qua4NAxKernel;
+
+/*!
+  \brief Dispatch of homogeneous batches of elements to the specialized kernels
+
+  All methods work on the elements from index first (included) to last (excluded) of the list, these elements must all be of the same type. Elements of an unknown type are processed by the generic methods of the Element class.
+  The critical time steps of the elements are updated with the Jacobian, see Element::computeCriticalTimeSteps(). When the erosion of the elements is enabled, the elements with a negative Jacobian are marked as inactive instead of stopping the computation of the Jacobian, see Model::updateActiveElements().
+  The strain increments are computed with the kinematics selected by the solver, see Element::computeStrains().
+  The stresses are computed by the batched radial return of the RadialReturn class, the integration points of the consecutive elements sharing the same material being processed together.
+  \ingroup dnlElements
+*/
+class ElementBatch
+{
+public:
+  static bool computeJacobian(List<Element *> &elements, long first, long last, bool reference = false, bool erode = false);
+  static void computeStrains(List<Element *> &elements, long first, long last, short kinematics = Element::PolarDecomposition);
+  static void computeStress(List<Element *> &elements, long first, long last, double timeStep);
+  static void computeInternalForces(List<Element *> &elements, long first, long last, double timeStep, Vector &internalForces);
+  static void computeElementKernel(List<Element *> &elements, long first, long last, double timeStep, Vector &internalForces, short kinematics = Element::PolarDecomposition);
+};
+
+//-----------------------------------------------------------------------------
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+inline bool ElementKernel<nNodes, nDim, nIntPts, axisymmetric>::computeJacobian(Element *element, bool reference)
+//-----------------------------------------------------------------------------
+{
+  Node *nodes[nNodes];
+
+  for (int nodeId = 0; nodeId < nNodes; nodeId++)
+    nodes[nodeId] = element->nodes(nodeId);
+
+  for (int intPtId = 0; intPtId < nIntPts; intPtId++)
+  {
+    IntegrationPoint *integrationPoint = element->integrationPoints(intPtId);
+    const IntegrationPointData *integrationPointData = integrationPoint->integrationPointData;
+    Mat<3, 3> &JxW = integrationPoint->JxW;
+
+    // Computes the Jacobian
+    JxW = 0.0;
+    for (int nodeId = 0; nodeId < nNodes; nodeId++)
+      for (int i = 0; i < nDim; i++)
+        for (int j = 0; j < nDim; j++)
+          JxW(i, j) += integrationPointData->derShapeFunction(nodeId, j) * nodes[nodeId]->coordinates(i);
+
+    // Computes the det of J
+    integrationPoint->detJ = (nDim == 3 ? JxW.getDeterminant3x3() : JxW.getDeterminant2x2());
+
+    // Test of the jacobian
+    if (integrationPoint->detJ < 0.0)
+    {
+      std::cerr << "Negative value of detJ encountered in element " << element->number << " at integration point " << intPtId + 1 << std::endl;
+      return false;
+    }
+
+    // Computes the inverse of the Jacobian
+    if (nDim == 3)
+      JxW.computeInverse3x3(integrationPoint->detJ, integrationPoint->invJxW);
+    else
+      JxW.computeInverse2x2(integrationPoint->detJ, integrationPoint->invJxW);
+
+    // Computes the derivatives of the Shape functions dShapeFunction = derShapeFunction . invJxW
+    for (int nodeId = 0; nodeId < nNodes; nodeId++)
+      for (int j = 0; j < nDim; j++)
+      {
+        double value = integrationPointData->derShapeFunction(nodeId, 0) * integrationPoint->invJxW(0, j);
+        for (int k = 1; k < nDim; k++)
+          value += integrationPointData->derShapeFunction(nodeId, k) * integrationPoint->invJxW(k, j);
+        integrationPoint->dShapeFunction(nodeId, j) = value;
+      }
+
+    // Computes the radius at the integration point for axisymmetric element
+    if (axisymmetric)
+    {
+      double radius = 0.0;
+      for (int nodeId = 0; nodeId < nNodes; nodeId++)
+        radius += integrationPointData->shapeFunction(nodeId) * nodes[nodeId]->coordinates(0);
+      integrationPoint->radius = radius;
+    }
+
+    // If the computation is made on the initial shape computes Initial values
+    if (reference)
+      integrationPoint->detJ0 = (axisymmetric ? integrationPoint->detJ * integrationPoint->radius : integrationPoint->detJ);
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+inline void ElementKernel<nNodes, nDim, nIntPts, axisymmetric>::computeStrains(Element *element, short kinematics)
+//-----------------------------------------------------------------------------
+{
+  NodalField *fields[nNodes];
+  Tensor2 F[nIntPts];
+  Tensor2 R[nIntPts];
+  SymTensor2 StrainInc[nIntPts];
+
+  for (int nodeId = 0; nodeId < nNodes; nodeId++)
+    fields[nodeId] = element->nodes(nodeId)->currentField;
+
+  for (int intPtId = 0; intPtId < nIntPts; intPtId++)
+  {
+    IntegrationPoint *integrationPoint = element->integrationPoints(intPtId);
+    double Vr = 0.0;
+
+    // Computation of the Gradient of deformation
+    F[intPtId].setToUnity();
+    for (int nodeId = 0; nodeId < nNodes; nodeId++)
+    {
+      for (int i = 0; i < nDim; i++)
+        for (int j = 0; j < nDim; j++)
+          F[intPtId](i, j) += integrationPoint->dShapeFunction(nodeId, j) * fields[nodeId]->displacement(i);
+      if (axisymmetric)
+        Vr += integrationPoint->integrationPointData->shapeFunction(nodeId) * fields[nodeId]->displacement(0);
+    }
+
+    // Axisymmetric term of F
+    if (axisymmetric)
+      F[intPtId](2, 2) += Vr / integrationPoint->radius;
+  }
+
+  // Polar decomposition or Hughes-Winget incremental rotation of all the integration points
+  if (kinematics == Element::HughesWinget)
+    Tensor2::hughesWinget(nIntPts, F, StrainInc, R);
+  else
+    Tensor2::polarDecomposeLnU(nIntPts, F, StrainInc, R, nDim == 2);
+
+  for (int intPtId = 0; intPtId < nIntPts; intPtId++)
+  {
+    IntegrationPoint *integrationPoint = element->integrationPoints(intPtId);
+    integrationPoint->StrainInc() = StrainInc[intPtId];
+    integrationPoint->R = R[intPtId];
+
+    // Compute the total strain tensor
+    integrationPoint->Strain() += integrationPoint->StrainInc();
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+inline void ElementKernel<nNodes, nDim, nIntPts, axisymmetric>::computeElementForces(Element *element, double *elementForces)
+//-----------------------------------------------------------------------------
+{
+  double WxdJ;
+
+  for (int I = 0; I < nNodes * nDim; I++)
+    elementForces[I] = 0.0;
+
+  // Boucle sur les points d'integration
+  for (int intPtId = 0; intPtId < nIntPts; intPtId++)
+  {
+    IntegrationPoint *integrationPoint = element->integrationPoints(intPtId);
+    const SymTensor2 &Stress = integrationPoint->Stress();
+
+    // calcul du terme d'integration numerique
+    WxdJ = integrationPoint->integrationPointData->weight * integrationPoint->detJ;
+    if (axisymmetric)
+      WxdJ *= dnl2PI * integrationPoint->radius;
+
+    // calcul des forces internes
+    for (int I = 0; I < nNodes; I++)
+    {
+      for (int i = 0; i < nDim; i++)
+        for (int j = 0; j < nDim; j++)
+          elementForces[I * nDim + i] -= integrationPoint->dShapeFunction(I, j) * Stress(j, i) * WxdJ;
+      if (axisymmetric)
+        elementForces[I * nDim] -= integrationPoint->integrationPointData->shapeFunction(I) * Stress(2, 2) / integrationPoint->radius * WxdJ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+inline void ElementKernel<nNodes, nDim, nIntPts, axisymmetric>::assembleElementForces(Element *element, const double *elementForces, Vector &internalForces)
+//-----------------------------------------------------------------------------
+{
+  for (int nodeId = 0; nodeId < nNodes; nodeId++)
+  {
+    long glob = element->nodes(nodeId)->internalNumber() * nDim;
+    for (int i = 0; i < nDim; i++)
+      internalForces(glob + i) += elementForces[nodeId * nDim + i];
+  }
+}
+
+/*!
+  The internal forces of the element are directly assembled into the global vector. The time step argument is unnamed here, it is only part of the signature for the kernels of the elements with hourglass control, see Hex8N3DRKernel.
+*/
+//-----------------------------------------------------------------------------
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+inline void ElementKernel<nNodes, nDim, nIntPts, axisymmetric>::computeInternalForces(Element *element, Vector &internalForces, double)
+//-----------------------------------------------------------------------------
+{
+  double elementForces[nNodes * nDim];
+
+  computeElementForces(element, elementForces);
+  assembleElementForces(element, elementForces, internalForces);
+}
+
+//-----------------------------------------------------------------------------
+template <int nNodes, int nDim, int nIntPts, bool axisymmetric>
+inline void ElementKernel<nNodes, nDim, nIntPts, axisymmetric>::computeDensity(Element *element)
+//-----------------------------------------------------------------------------
+{
+  for (int intPtId = 0; intPtId < nIntPts; intPtId++)
+  {
+    IntegrationPoint *integrationPoint = element->integrationPoints(intPtId);
+
+    integrationPoint->density() = element->material->density * integrationPoint->detJ0 / integrationPoint->detJ;
+
+    if (axisymmetric)
+      integrationPoint->density() /= integrationPoint->radius;
+  }
+}
+
+#endif
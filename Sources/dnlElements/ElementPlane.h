@@ -41,7 +41,7 @@ public:
   bool computeJacobian(bool reference = false);
   bool computeUnderJacobian(bool reference = false);
   void getV_atIntPoint(Vec3D &v, short time);
-  void computeElasticStiffnessMatrix(bool underIntegration = false);
+  void computeElasticStiffnessProduct(const double *vector, double *product, bool underIntegration = false);
 
   /*  
   void getU_atIntPoint (Vec3D & u, short time);
@@ -24,6 +24,9 @@
 #define __dnlElements_NodalField_h__
 
 #include <dnlMaths.h>
+#include <List.h>
+
+class Node;
 
 class NodalField
 {
@@ -41,8 +44,9 @@ public:
 
 public:
   NodalField();
-  NodalField(const NodalField &X);
+  NodalField(const NodalField &field);
   ~NodalField();
+  NodalField &operator=(const NodalField &field);
 
 #ifndef SWIG
   friend std::ifstream &operator>>(std::ifstream &, NodalField &);
@@ -57,4 +61,91 @@ public:
   void resetValues();
 };
 
+/*!
+  \class NodalFieldView
+  \brief Reference to the NodalField of a node
+
+  A NodalFieldView behaves as a pointer to a NodalField. It references the NodalField number index of an array of NodalField through the address of the pointer to this array, so that swapping two arrays of NodalField changes all the views at once.
+
+  \ingroup dnlElements
+*/
+class NodalFieldView
+{
+  NodalField **_fields = NULL; // Address of the pointer to the array of NodalField
+  long _index = 0;             // Index of the NodalField in the array
+
+public:
+  NodalFieldView() {}
+  ~NodalFieldView() {}
+
+  void attach(NodalField **fields, long index);
+  NodalField *operator->() const;
+  operator NodalField *() const;
+};
+
+/*!
+  \class NodalFieldStore
+  \brief Contiguous storage of the nodal fields of a model
+
+  This class stores the current and new nodal fields of all the nodes of a model in two contiguous arrays indexed by Node::internalNumber().
+  Nodal loops then stream linearly through memory and the transfer of the new nodal fields to the current ones at the end of an increment is a single pointer swap.
+  The fields of a node are kept together in a NodalField record rather than in one array per field: the nodal predictor and corrector read and write all the fields of a node at once, and the elements and the boundary conditions access them through a NodalField pointer.
+
+  \ingroup dnlElements
+*/
+class NodalFieldStore
+{
+  long _size = 0;
+
+public:
+  NodalField *currentFields = NULL; // Nodal fields at the begining of the current increment
+  NodalField *newFields = NULL;     // Nodal fields at the end of the current increment
+
+public:
+  NodalFieldStore() {}
+  ~NodalFieldStore();
+
+  long getSize() const;
+  void attach(List<Node *> nodes);
+  void swap();
+};
+
+//-----------------------------------------------------------------------------
+inline void NodalFieldView::attach(NodalField **fields, long index)
+//-----------------------------------------------------------------------------
+{
+  _fields = fields;
+  _index = index;
+}
+
+//-----------------------------------------------------------------------------
+inline NodalField *NodalFieldView::operator->() const
+//-----------------------------------------------------------------------------
+{
+  return *_fields + _index;
+}
+
+//-----------------------------------------------------------------------------
+inline NodalFieldView::operator NodalField *() const
+//-----------------------------------------------------------------------------
+{
+  return *_fields + _index;
+}
+
+//-----------------------------------------------------------------------------
+inline long NodalFieldStore::getSize() const
+//-----------------------------------------------------------------------------
+{
+  return _size;
+}
+
+//-----------------------------------------------------------------------------
+inline void NodalFieldStore::swap()
+//-----------------------------------------------------------------------------
+{
+  NodalField *tmp = newFields;
+  newFields = currentFields;
+  currentFields = tmp;
+}
+
 #endif
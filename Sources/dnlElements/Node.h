@@ -25,8 +25,8 @@
 
 #include <List.h>
 #include <Vec3D.h>
+#include <NodalField.h>
 
-class NodalField;
 class BoundaryCondition;
 class Element;
 
@@ -40,6 +40,7 @@ class Node
 {
   friend class ListIndex<Node *>; // To be able to use ListIndex
   long _listIndex;                // Local index used for the ListIndex management.
+  NodalField *_nodalFields[2];    // Own nodal fields of the node, used until the node is attached to a NodalFieldStore
 
 public:
   //double initialTemperature;     // Initial Temperature. This field is used to store the reference value of the temperature of the node at the begining of the calculus
@@ -50,10 +51,12 @@ public:
   double mass;                 // Mass. This field is used to store the value of the getJ2 nodal mass.
   List<Element *> elements;    // Element list. This pointer reference the list of the elements that contains a reference to the current node (ie: the list of the elements that includes this node).
   long number;                 // Identification number. This field represents the external identification number of the current node (ie. user representation).
-  NodalField *currentField;    // Nodal field of the node, ie. nodal field at the begining of the current increment
-  NodalField *newField;        // New Nodal field of the node, ie. nodal field at the end of the current increment
+  NodalFieldView currentField; // Nodal field of the node, ie. nodal field at the begining of the current increment
+  NodalFieldView newField;     // New Nodal field of the node, ie. nodal field at the end of the current increment
   Vec3D coordinates;           // Coordinates of the corresponding node.
   Vec3D displacement = 0.0;    // Displacement at the current node \f$ \overrightarrow{d} \f$
+  short timeStepClass = 0;     // Time step class of the node for the subcycling
+  bool active = true;          // The node belongs to at least one active element, see Model::updateActiveElements()
 
 public:
   Node(long nodeNumber = 1, double xCoord = 0.0, double yCoord = 0.0, double zCoord = 0.0);
@@ -72,6 +75,7 @@ public:
   SymTensor2 getNodalSymTensor(short field);
   Tensor2 getNodalTensor(short field);
   Vec3D getNodalVec3D(short field);
+  void attachNodalFields(NodalField **currentFields, NodalField **newFields);
   void swapNodalFields();
   void copyNodalFieldToNew();
 
@@ -0,0 +1,76 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file RadialReturn.h
+  \brief Declaration file for the batched radial return
+
+  This file declares the RadialReturn class used to integrate the constitutive law on a batch of integration points sharing the same material.
+  \ingroup dnlElements
+*/
+
+#ifndef __dnlElements_RadialReturn_h__
+#define __dnlElements_RadialReturn_h__
+
+#include <Element.h>
+
+#define RadialReturnBatchSize 256 //!< Maximum number of integration points of a batch
+
+/*!
+  \brief Batched radial return of the integration points of a material
+
+  The integration points of the elements added to the batch must all share the same material. The elastic trial states are first computed for all points of the batch, and the elastic ones are directly completed. The plastic points are then gathered into contiguous arrays (one lane per point) and the Newton-Raphson procedure is run on all the lanes at once: the hardening law is called only once per iteration for all the active lanes through HardeningLaw::getYieldStresses(), and the converged lanes are removed from the active ones at the end of each iteration.
+  The state variables of the integration points are read and written directly in IntegrationPoint::store through their slots, the slots of the elements of a batch being contiguous once the store has been laid out in the order of the chunks of elements, see Parallel.
+  Each lane runs the scalar radial return (Newton-Raphson on gamma starting from radialReturnGammaInitial, limited by radialReturnTolerance and radialReturnMaxIterations), so that the results of a point do not depend on the batch it belongs to. It is the only radial return used by the elements, see ElementBatch::computeStress().
+  \ingroup dnlElements
+*/
+class RadialReturn
+{
+  Material *_material = NULL;
+  int _size = 0;
+
+  // Trial states of the integration points of the batch
+  long _slots[RadialReturnBatchSize]; // Slots of the integration points in IntegrationPoint::store
+  SymTensor2 _stressOld[RadialReturnBatchSize];
+  SymTensor2 _deviatoricStress[RadialReturnBatchSize];
+  double _snorm0[RadialReturnBatchSize];
+  double _snorm[RadialReturnBatchSize];
+  double _gamma[RadialReturnBatchSize];
+  double _yield[RadialReturnBatchSize];
+  bool _plastic[RadialReturnBatchSize];
+
+  // Lanes of the Newton-Raphson procedure
+  int _lane[RadialReturnBatchSize];
+  int _iterate[RadialReturnBatchSize];
+  double _strial[RadialReturnBatchSize];
+  double _plasticStrain0[RadialReturnBatchSize];
+  double _temperature0[RadialReturnBatchSize];
+  double _laneSnorm0[RadialReturnBatchSize];
+  double _laneGamma[RadialReturnBatchSize];
+  double _gammaMin[RadialReturnBatchSize];
+  double _gammaMax[RadialReturnBatchSize];
+  double _plasticStrain[RadialReturnBatchSize];
+  double _plasticStrainRate[RadialReturnBatchSize];
+  double _temperature[RadialReturnBatchSize];
+  double _laneYield[RadialReturnBatchSize];
+  double _hard[RadialReturnBatchSize];
+  double _dgamma[RadialReturnBatchSize];
+
+private:
+  void computePlasticCorrection(double timeStep, int numberOfLanes);
+  void noConvergence(double timeStep, int lane);
+
+public:
+  bool add(Element *element);
+  void compute(double timeStep);
+};
+
+#endif
@@ -27,9 +27,11 @@
 #include <ElementAxi.h>
 #include <ElementData.h>
 #include <Element.h>
+#include <ElementKernel.h>
 #include <ElementPlane.h>
 #include <ElementSet.h>
 #include <ElHex8N3D.h>
+#include <ElHex8N3DR.h>
 #include <ElQua4N2D.h>
 #include <ElQua4NAx.h>
 #include <ElTet10N3D.h>
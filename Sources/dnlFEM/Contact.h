@@ -0,0 +1,123 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file Contact.h
+  \brief Declaration file for the Contact class
+
+  This file is the declaration file for the Contact class used to define the node to surface contact interfaces.
+  \ingroup dnlFEM
+*/
+
+#ifndef __dnlFEM_Contact_h__
+#define __dnlFEM_Contact_h__
+
+#include <List.h>
+#include <String.h>
+#include <Vec3D.h>
+
+class Element;
+class ElementSet;
+class Node;
+class NodeSet;
+class Vector;
+class MatrixDiag;
+
+#ifndef SWIG
+/*!
+  \brief Facet of a master surface
+
+  A facet is a segment in 2D and a triangle in 3D, the faces of the elements with more nodes being split into triangles. The nodes are ordered so that the normal of the facet is directed outside of the element.
+*/
+struct ContactFacet
+{
+  Node *nodes[3];   // Nodes of the facet
+  Element *element; // Element owning the facet
+};
+#endif
+
+/*!
+  \brief Penalty node to surface contact interface
+
+  A set of slave nodes is prevented from penetrating a master surface, made of the free faces of a set of elements, see init(). A slave node penetrating a facet of the master surface by a depth \f$ g \f$ along the outward normal \f$ \overrightarrow{n} \f$ of the facet receives the penalty force:
+  \f[ \overrightarrow{f}=\alpha\frac{m}{\Delta t^2}g\overrightarrow{n} \f]
+  where \f$ m=m_s m_f/(m_s+m_f) \f$ is the reduced mass of the slave node of mass \f$ m_s \f$ and of the facet of mass \f$ m_f \f$, interpolated from the masses of its nodes at the projection of the slave node, \f$ \Delta t \f$ is the time step and \f$ \alpha \f$ the penalty factor, see setPenaltyFactor(). The opposite force is spread over the nodes of the facet with the shape functions of the projection of the slave node.
+  The stiffness being scaled by the reduced mass, the penalty force doesn't depend on the material and the pulsation of the slave node against the facet is \f$ \sqrt{\alpha}/\Delta t \f$, whatever the ratio of their masses. This pulsation adds to the ones of the elements, so that the contact does reduce the critical time step: the penalty factor must stay small compared to the stability limit of 4 of the contact alone.
+  A slave node is in contact if it is behind the closest facet on which it projects, see computeForces().
+
+  The broad phase uses a spatial hash of cubic buckets: each facet is stored in all the buckets overlapping its bounding box enlarged by a margin, see setBucketMargin(), so that the candidate facets of a slave node are the facets stored in its bucket. The hash is rebuilt only when one of the master nodes has moved more than the margin since the last build, the slave nodes being free to move between the buckets. The narrow phase is computed in parallel over the slave nodes, the forces being assembled afterward for the nodes in contact only.
+  \ingroup dnlFEM
+*/
+class Contact
+{
+private:
+  double _penaltyFactor = 0.5;    // Penalty factor of the mass scaled stiffness
+  double _bucketMargin = 0.0;     // Margin of the bounding boxes of the facets (0 for a quarter of the mean size of the facets)
+  double _bucketSize = 0.0;       // Size of the buckets
+  double _margin = 0.0;           // Margin used for the current spatial hash
+  long _searches = 0;             // Number of builds of the spatial hash
+  long _contactNodes = 0;         // Number of slave nodes in contact at the last increment
+  short _numberOfDimensions = 0;  // Number of dimensions of the model
+  unsigned long _hashMask = 0;    // Number of entries of the spatial hash minus one
+  ElementSet *_masterSet = NULL;  // Elements of the master surface
+  NodeSet *_slaveSet = NULL;      // Slave nodes
+#ifndef SWIG
+  List<ContactFacet> _facets;     // Facets of the master surface
+#endif
+  List<Node *> _masterNodes;      // Nodes of the master surface
+  Vec3D *_masterCoordinates = NULL; // Coordinates of the master nodes at the last build of the spatial hash
+  long *_bucketStart = NULL;      // Index of the first facet of each entry of the spatial hash, plus the total
+  long *_bucketFacets = NULL;     // Facets of the entries of the spatial hash
+  long *_slaveFacets = NULL;      // Facet in contact with each slave node (-1 if none)
+  Vec3D *_slaveWeights = NULL;    // Shape functions of the projection of each slave node on its facet
+  Vec3D *_slaveForces = NULL;     // Contact force of each slave node
+
+private:
+  void buildSpatialHash();
+  void getBucket(const Vec3D &point, long cell[3]);
+  unsigned long hashBucket(long i, long j, long k);
+  bool masterSurfaceMoved();
+  bool projectOnFacet(Node *slave, long facetId, double &gap, Vec3D &normal, Vec3D &weights);
+
+public:
+  String name = "_noname_"; // Name of the contact interface
+
+public:
+  Contact(char *newName = NULL);
+  Contact(const Contact &contact);
+  ~Contact();
+
+  long getNumberOfContactNodes();
+  long getNumberOfFacets();
+  long getNumberOfSearches();
+  void computeForces(double timeStep, const MatrixDiag &massMatrix, Vector &forces);
+  void init(short numberOfDimensions);
+  void setBucketMargin(double margin);
+  void setMasterSurface(ElementSet *elementSet);
+  void setPenaltyFactor(double factor);
+  void setSlaveNodes(NodeSet *nodeSet);
+};
+
+//-----------------------------------------------------------------------------
+inline long Contact::getNumberOfContactNodes()
+//-----------------------------------------------------------------------------
+{
+  return _contactNodes;
+}
+
+//-----------------------------------------------------------------------------
+inline long Contact::getNumberOfSearches()
+//-----------------------------------------------------------------------------
+{
+  return _searches;
+}
+
+#endif
@@ -0,0 +1,110 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file Domain.h
+  \brief Declaration file for the Domain class
+
+  This file is the declaration file for the Domain class used for the distributed memory domain decomposition.
+  \ingroup dnlFEM
+*/
+
+#ifndef __dnlFEM_Domain_h__
+#define __dnlFEM_Domain_h__
+
+#include <List.h>
+#include <String.h>
+
+class Element;
+class MatrixDiag;
+class Node;
+class Vector;
+
+/*!
+  \brief Distributed memory domain decomposition
+
+  When DynELA is compiled with the DYNELA_MPI flag and run with mpirun, each MPI process reads the whole model and computes one domain of it: the elements are split into as many domains as processes, see decompose(), and each process only computes the elements of its domain and integrates the nodes of these elements, the threads of the process sharing this work as usual, see Parallel.
+  The nodes shared by several domains are the interface nodes. Each domain assembles the internal forces of its own elements, the forces of the interface nodes are then summed over the domains sharing them once per increment, see sumOnInterfaces(), so that all these domains integrate the interface nodes with the same forces and get the same nodal values. The contributions of the domains are always summed in the order of the domains, the values of the interface nodes are then bitwise identical in all the domains. The mass matrix is assembled the same way and the critical time step is the minimum over the domains, see getMinimum().
+  The contact interfaces, the rigid walls and the birth of elements act on nodes or elements of any domain and are not available with several domains, see Model::initSolve().
+  Without the DYNELA_MPI flag, or with a single process, there is only one domain and all the methods of this class do nothing.
+  \ingroup dnlFEM
+*/
+class Domain
+{
+private:
+  int _rank = 0;                   // Number of the domain of the current process
+  int _numberOfDomains = 1;        // Number of domains
+  bool _initialized = false;       // MPI has been initialized by this object
+  int *_elementDomain = NULL;      // Domain of each element, indexed by the internal number of the element
+  int *_nodeOwner = NULL;          // Domain owning each node (the lowest domain sharing it), indexed by the internal number of the node
+  List<int> _neighbours;           // Neighbour domains, in ascending order
+  List<long> _neighbourStart;      // Index of the first interface node of each neighbour domain in _neighbourNodes, plus the total
+  List<long> _neighbourNodes;      // Internal numbers of the interface nodes shared with each neighbour domain, in ascending order
+  List<long> _interfaceNodes;      // Internal numbers of the interface nodes of the current domain
+  List<long> _interfaceStart;      // Index of the first contribution of each interface node in _interfaceSources, plus the total
+  List<long> _interfaceSources;    // Sources of the contributions of each interface node in the order of the domains (-1 for the current domain, index of the interface node in _neighbourNodes otherwise)
+
+private:
+  template <class T>
+  void _sumOnInterfaces(T &values, short numberOfDimensions);
+
+public:
+  String name = "_noname_"; // Name of the domain decomposition
+
+public:
+  Domain(char *newName = NULL);
+  Domain(const Domain &domain);
+  ~Domain();
+
+  bool isLocal(Element *element);
+  bool isMaster();
+  bool isOwned(Node *node);
+  double getMaximum(double value);
+  double getMinimum(double value);
+  double getSum(double value);
+  int getNumberOfDomains();
+  int getRank();
+  long getNumberOfInterfaceNodes();
+  void decompose(List<Element *> &elements, long numberOfNodes);
+  void sum(double *values, long size);
+  void sumOnInterfaces(MatrixDiag &values, short numberOfDimensions);
+  void sumOnInterfaces(Vector &values, short numberOfDimensions);
+};
+
+//-----------------------------------------------------------------------------
+inline int Domain::getRank()
+//-----------------------------------------------------------------------------
+{
+  return _rank;
+}
+
+//-----------------------------------------------------------------------------
+inline int Domain::getNumberOfDomains()
+//-----------------------------------------------------------------------------
+{
+  return _numberOfDomains;
+}
+
+//-----------------------------------------------------------------------------
+inline bool Domain::isMaster()
+//-----------------------------------------------------------------------------
+{
+  return (_rank == 0);
+}
+
+//-----------------------------------------------------------------------------
+inline long Domain::getNumberOfInterfaceNodes()
+//-----------------------------------------------------------------------------
+{
+  return _interfaceNodes.getSize();
+}
+
+#endif
@@ -26,12 +26,15 @@
 #include <omp.h>
 #include <dnlKernel.h>
 #include <Parallel.h>
+#include <Domain.h>
 #include <Drawing.h>
 #include <Model.h>
 
 class DynELA;
 class VtkInterface;
 class Boundary;
+class Contact;
+class RigidWall;
 class HistoryFile;
 class Solver;
 class Material;
@@ -67,6 +70,7 @@ public:
   double nextSaveTime = 0.0;      // Next save time
   double saveTimeIncrement = 0.0; // Increment of save time
   double startSaveTime = 0.0;     // Start save time
+  Domain domain;                  // Domain decomposition
   Drawing drawing;                //
   Model model;                    //
   Parallel parallel;              // Parallel computation
@@ -91,10 +95,12 @@ public:
   long getElementsNumber();
   long getNodesNumber();
   Node *getNodeByNum(long nodeNumber);
+  void add(Contact *contact);
   void add(ElementSet *elementSet, long startNumber = -1, long endNumber = -1, long increment = 1);
   void add(HistoryFile *newHistoryFile);
   void add(Material *material, ElementSet *elementSet);
   void add(NodeSet *nodeSet, long startNumber = -1, long endNumber = -1, long increment = 1);
+  void add(RigidWall *rigidWall);
   void add(Solver *newSolver);
   void addMaterial(Material *material);
   void attachConstantBC(Boundary *boundary, NodeSet *nodeSet);
@@ -42,7 +42,10 @@ private:
   double _beta;
   double _gamma;
   double _rho_b;
-  short _timeStepMethod;
+  bool _fusedElementKernel = false; // Use the fused element kernel
+  int _timingSampleFrequency = 0;   // Frequency of the multi-pass increments used to sample the per phase timers
+  int _subcyclingClasses = 1;       // Number of power of two time step classes for the subcycling (1 means no subcycling)
+  long _subStep = 0;                // Index of the sub-step inside the subcycling cycle
 
   void computeChungHulbertIntegrationParameters();
 
@@ -57,6 +60,9 @@ public:
   void endStep();
   void explicitSolve();
   void setDissipation(double dissipation);
+  void setFusedElementKernel(bool fused);
+  void setSubcyclingClasses(int classes);
+  void setTimingSampleFrequency(int frequency);
   void solve(double solveUpToTime);
   void updateTimes();
 };
@@ -44,6 +44,7 @@ public:
   HistoryFileItem();
   ~HistoryFileItem();
 
+  virtual bool isOwned() = 0;
   virtual double getValue() = 0;
 };
 
@@ -59,6 +60,7 @@ public:
   HistoryFileNodeItem();
   ~HistoryFileNodeItem();
 
+  bool isOwned();
   double getValue();
 };
 
@@ -75,6 +77,7 @@ public:
   HistoryFileElementItem();
   ~HistoryFileElementItem();
 
+  bool isOwned();
   double getValue();
 };
 
@@ -87,6 +90,7 @@ public:
   HistoryFileGlobalItem();
   ~HistoryFileGlobalItem();
 
+  bool isOwned();
   double getValue();
 };
 
@@ -25,13 +25,16 @@
 
 #include <MatrixDiag.h>
 #include <Vector.h>
+#include <NodalField.h>
 
+class Contact;
 class DynELA;
 class Element;
 class ElementSet;
 class HistoryFile;
 class Node;
 class NodeSet;
+class RigidWall;
 class Solver;
 class Material;
 
@@ -51,10 +54,25 @@ private:
   int _powerIterationMaxIterations = 1000; // Max number of iterations for the Power Iteration Agorithm
   short _numberOfDimensions = 0;           // Number of dimensions of the model
   Vector _powerIterationEV;
+  List<long> _subcycleClassSizes;          // Number of elements of each time step class for the subcycling
+  Vector _subcycleDisplacements;           // Nodal displacements at the last update of each time step class (last increment for the class 0)
+  long _subcycledElementUpdates = 0;       // Number of element updates done with the subcycling
+  long _elementUpdates = 0;                // Number of element updates without the subcycling
+  double _addedMass = 0.0;                 // Mass added by the mass scaling
+  double _erosionPlasticStrain = 0.0;      // Maximum equivalent plastic strain of the elements (no erosion if null)
+  double _erosionTimeStep = 0.0;           // Minimum Courant time step of the elements (no erosion if null)
+  double _erosionVolumeRatio = 0.0;        // Minimum volume ratio of the elements (no erosion if null)
+  long _erodedElements = 0;                // Number of eroded elements
+  List<ElementSet *> _birthSets;           // Sets of elements waiting for their birth
+  List<double> _birthTimes;                // Birth times of the sets of elements
+
+private:
+  void _dispatchActiveElementsAndNodes();
 
 public:
   double currentTime = 0.0;         // Temps actuel du modele
   double nextTime = 0.0;            // Temps actuel du modele + increment de temps
+  List<Contact *> contacts;         // List of the contact interfaces
   List<ElementSet *> elementsSets;  // List of the Elements Sets
   List<HistoryFile *> historyFiles; // List of the History Files
   List<Material *> materials;       // Materials list of the structure
@@ -62,6 +80,8 @@ public:
   ListIndex<Element *> elements;    // List of the Elements
   ListIndex<Node *> nodes;          // List of the Nodes
   MatrixDiag massMatrix;            // Mass matrix
+  NodalFieldStore nodalFields;      // Contiguous storage of the nodal fields
+  List<RigidWall *> rigidWalls;     // List of the rigid walls
   Solver *solver = NULL;            // solveurs associes au modele
   String name = "_noname_";         // Name of the model
   Vector internalForces;            // Vecteur des forces internes
@@ -69,9 +89,11 @@ public:
 private:
   bool add(Element *pel);
   bool add(Node *pnd);
+  void add(Contact *contact);
   void add(ElementSet *elementSet, long startNumber = -1, long endNumber = -1, long increment = 1);
   void add(HistoryFile *newHistoryFile);
   void add(NodeSet *nodeSet, long startNumber = -1, long endNumber = -1, long increment = 1);
+  void add(RigidWall *rigidWall);
   void add(Solver *newSolver);
 
 public:
@@ -84,23 +106,40 @@ public:
   bool initSolve();
   bool solve(double solveUpToTime = -1.0);
   double computeCourantTimeStep();
+  double computeEigenvalueBoundTimeStep();
   double computePowerIterationTimeStep(bool underIntegration = false);
   double getEndSolveTime();
   double getTotalKineticEnergy();
+  double getAddedMass();
+  double getKineticEnergyRatio();
+  double getTotalHourglassEnergy();
+  double getTotalInternalEnergy();
   double getTotalMass();
   Element *getElementByNum(long elementNumber);
   Node *getNodeByNum(long nodeNumber);
+  long getNumberOfErodedElements();
   short getNumberOfDimensions();
+  bool updateActiveElements();
+  void applyRigidWalls();
   void compactNodesAndElements();
+  void computeContactForces(double timeStep);
+  void computeElementKernel(double timeStep, short kinematics);
   void computeFinalRotation();
   void computeInternalForces();
   void computeJacobian(bool reference = false);
   void computeUnderJacobian(bool reference = false);
   void computeMassMatrix(bool forceComputation = false);
+  void computeMassScaling(double criticalTimeStep, bool eigenvalueBound = false);
   void computePressure();
-  void computeStrains();
+  void computeStrains(short kinematics);
   void computeStress(double timeStep);
+  void computeSubcycledElementKernel(double timeStep, long subStep, short kinematics);
+  void computeTimeStepClasses(int numberOfClasses, bool reset = false);
   void create(Element *pel, long *listOfNodesNumber);
+  void setBirthTime(ElementSet *elementSet, double time);
+  void setErosionPlasticStrain(double plasticStrain);
+  void setErosionTimeStep(double timeStep);
+  void setErosionVolumeRatio(double volumeRatio);
   void transfertQuantities();
   void writeHistoryFiles();
 
@@ -143,4 +182,11 @@ inline short Model::getNumberOfDimensions()
   return _numberOfDimensions;
 }
 
+//-----------------------------------------------------------------------------
+inline long Model::getNumberOfErodedElements()
+//-----------------------------------------------------------------------------
+{
+  return _erodedElements;
+}
+
 #endif
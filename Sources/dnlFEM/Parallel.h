@@ -27,6 +27,7 @@
 #include <omp.h>
 
 class Element;
+class Node;
 
 /* #include <iostream>
 #include <fstream>
@@ -35,23 +36,67 @@ class ElementsChunk
 {
 public:
   List<Element *> elements; // List of the elements of the chunk
+  List<long> batches;       // Index of the first element of each batch of elements of the same type and class, plus the number of elements
 
 public:
   ElementsChunk() {}
   ~ElementsChunk() {}
+  long getNumberOfBatches();
+  long removeInactiveElements();
+  void sortByType();
 };
 
+//-----------------------------------------------------------------------------
+inline long ElementsChunk::getNumberOfBatches()
+//-----------------------------------------------------------------------------
+{
+  return batches.getSize() - 1;
+}
+
+class NodesChunk
+{
+public:
+  List<Node *> nodes; // List of the nodes of the chunk
+
+public:
+  NodesChunk() {}
+  ~NodesChunk() {}
+};
+
+/*!
+  \brief Dispatch of the elements and nodes on the cores
+
+  The elements are dispatched on the cores by a partitioner, see setPartitioner(). With the RoundRobin partitioner, the default one, the element i is given to the core i modulo the number of cores, so that each core touches nodes scattered over the whole mesh. The Bisection and Hilbert partitioners give each core a compact block of elements, so that most of the nodes of a core are only touched by this core, the nodes shared by several cores being the boundary nodes of the partitions, see getNumberOfBoundaryNodes(). With these partitioners, the nodes and the color groups also follow the partition, see dispatchNodes() and colorElements().
+  The internal forces are assembled in a different order with each partitioner, so that the results of the partitioners only differ by round-off errors.
+  \ingroup dnlFEM
+*/
 class Parallel
 {
+public:
+  enum
+  {
+    RoundRobin,
+    Bisection,
+    Hilbert
+  };
 
 private:
   int _cores = 1;
   int _maxThreads = 1;
-  ElementsChunk **_elementsChunks; // Elements chunks
+  short _partitioner = RoundRobin;      // Partitioner of the elements on the cores
+  ElementsChunk **_elementsChunks;      // Elements chunks
+  List<ElementsChunk **> _colorsChunks; // Elements chunks of each color group
+  NodesChunk **_nodesChunks;            // Nodes chunks
+  int *_elementsCore = NULL;            // Core of each dispatched element, indexed by the internal number of the element, -1 for the elements not dispatched
+  long _elementsCoreSize = 0;           // Size of _elementsCore, the largest internal number of the dispatched elements plus one
+  List<long> _boundaryNodes;            // Number of boundary nodes of each core
 
 private:
   ElementsChunk **_initChunkList();
+  void _countBoundaryNodes();
   void _deleteChunkList(ElementsChunk **chunkList);
+  int _getElementCore(Element *element);
+  void _layoutIntegrationPoints();
 
 public:
   String name = "_noname_";
@@ -62,11 +107,30 @@ public:
 
   ElementsChunk *getElementsOfCore(int core);
   ElementsChunk *getElementsOfCurrentCore();
+  ElementsChunk *getElementsOfCurrentCore(int color);
+  NodesChunk *getNodesOfCurrentCore();
+  int getColors();
   int getCores();
+  long getNumberOfBoundaryNodes(int core);
+  long removeInactiveElements();
+  short getPartitioner();
+  static void partition(List<Element *> &elements, int numberOfParts, short partitioner, int *parts);
+  void colorElements(List<Element *> elementList);
   void dispatchElements(List<Element *> elementList);
+  void dispatchNodes(List<Node *> nodeList);
+  void removeInactiveNodes();
   void setCores(int cores);
+  void setPartitioner(short partitioner);
+  void sortElements();
 };
 
+//-----------------------------------------------------------------------------
+inline short Parallel::getPartitioner()
+//-----------------------------------------------------------------------------
+{
+  return _partitioner;
+}
+
 //-----------------------------------------------------------------------------
 inline int Parallel::getCores()
 //-----------------------------------------------------------------------------
@@ -74,6 +138,13 @@ inline int Parallel::getCores()
   return _cores;
 }
 
+//-----------------------------------------------------------------------------
+inline int Parallel::getColors()
+//-----------------------------------------------------------------------------
+{
+  return _colorsChunks.getSize();
+}
+
 //-----------------------------------------------------------------------------
 inline ElementsChunk *Parallel::getElementsOfCore(int core)
 //-----------------------------------------------------------------------------
@@ -88,4 +159,18 @@ inline ElementsChunk *Parallel::getElementsOfCurrentCore()
   return _elementsChunks[omp_get_thread_num()];
 }
 
+//-----------------------------------------------------------------------------
+inline ElementsChunk *Parallel::getElementsOfCurrentCore(int color)
+//-----------------------------------------------------------------------------
+{
+  return _colorsChunks(color)[omp_get_thread_num()];
+}
+
+//-----------------------------------------------------------------------------
+inline NodesChunk *Parallel::getNodesOfCurrentCore()
+//-----------------------------------------------------------------------------
+{
+  return _nodesChunks[omp_get_thread_num()];
+}
+
 #endif
@@ -0,0 +1,135 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file RigidWall.h
+  \brief Declaration file for the RigidWall class
+
+  This file is the declaration file for the RigidWall class used to define the analytic rigid surfaces.
+  \ingroup dnlFEM
+*/
+
+#ifndef __dnlFEM_RigidWall_h__
+#define __dnlFEM_RigidWall_h__
+
+#include <List.h>
+#include <String.h>
+#include <Vec3D.h>
+
+class Function;
+class Node;
+class NodeSet;
+
+/*!
+  \brief Analytic rigid surface
+
+  A rigid wall is a plane, a cylinder or a sphere, the nodes of the wall being kept on the side of the surface where the signed distance to the surface is positive. The wall can be moved by a translation driven by a Function, see setMotion().
+  The wall acts on a list of nodes built once by init() from the sets of nodes given by add(), generally the nodes of the boundary of the structure. After the update of the coordinates of the nodes by the explicit solver, a node with a negative distance to the wall is brought back on the surface, and the components of its speed and acceleration going inside the wall are removed, see apply(). The wall is frictionless, the nodes being free to slide on the surface and to leave it.
+  The cost of the wall is one signed distance test per node of its list and per increment, without any contact search.
+  \ingroup dnlFEM
+*/
+class RigidWall
+{
+public:
+  enum
+  {
+    Plane,
+    Cylinder,
+    Sphere
+  };
+
+private:
+  short _type = Plane;            // Type of surface of the wall
+  bool _inside = false;           // The nodes are kept inside the cylinder or the sphere
+  double _radius = 0.0;           // Radius of the cylinder or the sphere
+  long _contactNodes = 0;         // Number of nodes brought back on the wall at the last increment
+  Vec3D _point;                   // Point of the plane, point of the axis of the cylinder, center of the sphere
+  Vec3D _direction;               // Normal of the plane, axis of the cylinder
+  Vec3D _displacement;            // Displacement of the wall for a unit value of the function
+  Function *_function = NULL;     // Function of the motion of the wall
+  List<NodeSet *> _nodeSets;      // Sets of nodes of the wall
+  List<Node *> _nodes;            // Nodes of the wall
+
+private:
+  bool getDistance(const Vec3D &point, double &distance, Vec3D &normal);
+
+public:
+  String name = "_noname_"; // Name of the rigid wall
+
+public:
+  RigidWall(char *newName = NULL);
+  RigidWall(const RigidWall &rigidWall);
+  ~RigidWall();
+
+  long getNumberOfContactNodes();
+  long getNumberOfNodes();
+  void add(NodeSet *nodeSet);
+  void apply(double time);
+  void init();
+  void setCylinder(const Vec3D &point, const Vec3D &axis, double radius, bool inside = false);
+  void setMotion(Function *function, const Vec3D &displacement);
+  void setPlane(const Vec3D &point, const Vec3D &normal);
+  void setSphere(const Vec3D &center, double radius, bool inside = false);
+};
+
+//-----------------------------------------------------------------------------
+inline long RigidWall::getNumberOfContactNodes()
+//-----------------------------------------------------------------------------
+{
+  return _contactNodes;
+}
+
+//-----------------------------------------------------------------------------
+inline long RigidWall::getNumberOfNodes()
+//-----------------------------------------------------------------------------
+{
+  return _nodes.getSize();
+}
+
+/*!
+  \brief Signed distance of a point to the surface of the wall
+  \param point point expressed in the initial position of the wall
+  \param distance returned signed distance, positive on the side of the nodes
+  \param normal returned normal of the surface at the closest point, directed toward the side of the nodes
+  \return false if the normal is not defined, on the axis of the cylinder or at the center of the sphere
+*/
+//-----------------------------------------------------------------------------
+inline bool RigidWall::getDistance(const Vec3D &point, double &distance, Vec3D &normal)
+//-----------------------------------------------------------------------------
+{
+  Vec3D position = point - _point;
+
+  if (_type == Plane)
+  {
+    normal = _direction;
+    distance = position.dotProduct(_direction);
+    return true;
+  }
+
+  // Radial vector of the cylinder or the sphere
+  if (_type == Cylinder)
+    position -= position.dotProduct(_direction) * _direction;
+
+  double radius = position.getNorm();
+  if (radius == 0.0)
+    return false;
+
+  normal = position / radius;
+  distance = radius - _radius;
+  if (_inside)
+  {
+    normal = -normal;
+    distance = -distance;
+  }
+  return true;
+}
+
+#endif
@@ -54,16 +54,27 @@ protected:
   double _omegaS = 2.0;
   double _solveUpToTime = 0.0;
   double _timeStepSafetyFactor = 0.9;
+  double _targetTimeStep = 0.0; // Target time step of the mass scaling (no mass scaling if null)
+  double _timeStepTolerance = 0.0; // Tolerance on the relative change of the time step between two computations (fixed frequency if null)
+  double _computedTimeStep = 0.0;     // Value of the time step at the last computation
+  double _computedTimeStepDate = 0.0; // Date of the last computation of the time step
+  double _timeStepSlope = 0.0;        // Time derivative of the time step used for the extrapolation
+  double _monitorTimeStep = 0.0;      // Element eigenvalue bound time step at the last computation
+  long _computedTimeStepIncrement = -1; // Increment of the last computation of the time step
+  long _nextTimeStepIncrement = 0;      // Increment of the next computation of the time step
   int _computeTimeStepFrequency = 10;
+  int _maximumComputeTimeStepFrequency = 100;
   int _reportFrequency = 100;
   short _timeStepMethod = Courant;
+  short _kinematics = 0; // Kinematics of the strain increments, see Element::computeStrains()
 
 public:
   enum
   {
     Courant,
     PowerIteration,
-    PowerIterationUnder
+    PowerIterationUnder,
+    EigenvalueBound
   };
 
 public:
@@ -89,11 +100,15 @@ public:
   void computeTimeStep(bool forceComputation = false);
   void initialize();
   void setComputeTimeStepFrequency(int frequency);
+  void setMaximumComputeTimeStepFrequency(int frequency);
   void setIncrements(long start, long stop);
+  void setKinematics(short kinematics);
   void setModel(Model *newModel);
+  void setTargetTimeStep(double targetTimeStep);
   void setTimes(double start_time, double end_time);
   void setTimeStepMethod(short method);
   void setTimeStepSafetyFactor(double safetyfactor);
+  void setTimeStepTolerance(double tolerance);
   // member functions
   /* 
   bool timeOk ();
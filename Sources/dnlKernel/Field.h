@@ -61,6 +61,9 @@ public:
     timeStep,                           //!< TimeStep
     realTimeStep,                       //!< Real timeStep taking into account the reducing due to saves
     kineticEnergy,                      //!< Kinetic energy of the current model
+    hourglassEnergy,                    //!< Work of the hourglass forces of the current model
+    addedMass,                          //!< Mass added by the mass scaling to the current model
+    kineticEnergyRatio,                 //!< Ratio of the kinetic energy to the internal energy of the current model
     yieldStress,                        //!< Maximum yield Stress of the point
     FIELD_TENSOR2(Strain),              // Strain tensor
     FIELD_TENSOR2(StrainInc),           // Increment of the Strain tensor
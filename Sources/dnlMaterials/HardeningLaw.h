@@ -39,6 +39,7 @@ class ElementSet;
 class IntegrationPoint;
 class Element;
 class Material;
+class HardeningTable;
 
 /*!
   \brief Classe virtuelle de gestion des materiaux
@@ -67,6 +68,8 @@ protected:
   int _lawType = Virtual;
   Material *_material = NULL;
   String _lawName = "";
+  HardeningTable *_table = NULL;   // Table of the yield stress, see setTabulation()
+  bool _tabulated = false;         // The table has been computed
 
 public:
   HardeningLaw();
@@ -82,7 +85,13 @@ public:
   virtual double &getParameter(int parameter) = 0;
   virtual double getYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL) = 0;
   virtual double getDerivateYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL) = 0;
+  virtual void computeYieldStresses(int size, const double *plasticStrain, const double *plasticStrainRate, const double *T, double dtime, double *yieldStress, double *derivateYieldStress);
+  void getYieldStresses(int size, const double *plasticStrain, const double *plasticStrainRate, const double *T, double dtime, double *yieldStress, double *derivateYieldStress);
   void add(Material *material);
+  bool isTabulated();
+  HardeningTable *getTable();
+  void setTabulation(int strainPointsPerOctave, double minimumStrain, double maximumStrain, int ratePointsPerOctave = 0, double minimumRate = 1.0, double maximumRate = 1.0, int temperaturePoints = 1, double minimumTemperature = 0.0, double maximumTemperature = 0.0);
+  void tabulate();
 
   /* 
   void plotToFile(String , double  = 5);
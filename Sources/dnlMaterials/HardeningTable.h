@@ -0,0 +1,186 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file HardeningTable.h
+  \brief Declaration file for the HardeningTable class
+
+  This file is the declaration file for the HardeningTable class used to tabulate the hardening laws.
+  \ingroup dnlMaterials
+*/
+
+#ifndef __dnlMaterials_HardeningTable_h__
+#define __dnlMaterials_HardeningTable_h__
+
+#include <dnlMaths.h>
+#include <cstring>
+
+class HardeningLaw;
+
+/*!
+  \brief Table of the yield stress of a hardening law
+
+  The yield stress \f$ \sigma^y \f$ of a hardening law is tabulated on a grid over the plastic strain \f$ \overline{\varepsilon^{p}} \f$, the plastic strain rate \f$ \stackrel{\bullet}{\overline{\varepsilon^{p}}} \f$ and the temperature \f$ T \f$. Along the plastic strain and the plastic strain rate, the grid has a given number of regularly spaced points in each octave \f$ [2^e, 2^{e+1}[ \f$, so that the relative spacing of the grid is almost constant as with a logarithmic scale, while the cell containing a value is directly given by the exponent and the mantissa of its floating point representation, without any call to log(). The grid is regular along the temperature.
+  The yield stress is obtained by trilinear interpolation of the values at the nodes of the grid, and its derivatives are the exact derivatives of the interpolation, so that the Newton-Raphson procedure of the radial return is consistent with the interpolated law. The interpolation error is bounded by:
+  \f[ \left|\sigma^y-\tilde{\sigma}^y\right| \leq \frac{1}{8}\left(h_{\varepsilon}^2\max\left|\frac{\partial^2\sigma^y}{\partial\overline{\varepsilon^{p}}^2}\right|+h_{\stackrel{\bullet}{\varepsilon}}^2\max\left|\frac{\partial^2\sigma^y}{\partial\stackrel{\bullet}{\overline{\varepsilon^{p}}}^2}\right|+h_T^2\max\left|\frac{\partial^2\sigma^y}{\partial T^2}\right|\right) \f]
+  where \f$ h \f$ are the sizes of the cell, with \f$ h_{\varepsilon} \leq \overline{\varepsilon^{p}}/n \f$ for \f$ n \f$ points per octave. The maximum relative error measured at the centers of the cells is computed by build(). Points outside of the grid are not interpolated, the exact hardening law must then be used.
+  An axis with no point per octave (plastic strain rate) or with only one point (temperature) is not tabulated, the hardening law must then not depend on the corresponding variable.
+  \ingroup dnlMaterials
+*/
+class HardeningTable
+{
+  int _pointsPerOctave[2]; // Number of points per octave along the plastic strain and the plastic strain rate
+  int _minimumExponent[2]; // Exponent of the first octave along the plastic strain and the plastic strain rate
+  int _points[3];          // Number of points along each axis
+  long _stride[3];         // Strides of the axis in the table
+  double _minimumTemperature = 0.0;     // Minimum temperature of the grid
+  double _temperatureStep = 0.0;        // Step of the grid along the temperature
+  double _thermalFactor = 0.0;          // Taylor-Quinney coefficient over rho.Cp
+  double _maximumError = 0.0;           // Maximum relative interpolation error
+  Vec3D _maximumErrorPoint;             // Plastic strain, plastic strain rate and temperature of the maximum error
+  double *_values = NULL;               // Yield stress at the nodes of the grid
+
+private:
+  bool getOctaveCell(int axis, double value, long &cell, double &fraction, double &size) const;
+  double getNodeValue(int axis, long node) const;
+
+public:
+  HardeningTable(int strainPointsPerOctave, double minimumStrain, double maximumStrain, int ratePointsPerOctave, double minimumRate, double maximumRate, int temperaturePoints, double minimumTemperature, double maximumTemperature);
+  ~HardeningTable();
+
+  bool getYieldStress(double plasticStrain, double plasticStrainRate, double T, double dtime, double &yieldStress, double &derivateYieldStress) const;
+  double getMaximumError() const;
+  long getNumberOfPoints() const;
+  Vec3D getMaximumErrorPoint() const;
+  void build(HardeningLaw *law, double thermalFactor);
+};
+
+//-----------------------------------------------------------------------------
+inline double HardeningTable::getMaximumError() const
+//-----------------------------------------------------------------------------
+{
+  return _maximumError;
+}
+
+//-----------------------------------------------------------------------------
+inline Vec3D HardeningTable::getMaximumErrorPoint() const
+//-----------------------------------------------------------------------------
+{
+  return _maximumErrorPoint;
+}
+
+//-----------------------------------------------------------------------------
+inline long HardeningTable::getNumberOfPoints() const
+//-----------------------------------------------------------------------------
+{
+  return long(_points[0]) * _points[1] * _points[2];
+}
+
+/*!
+  \brief Cell of an octave axis containing a value
+
+  \param axis axis of the grid (0 for the plastic strain, 1 for the plastic strain rate)
+  \param value value of the variable
+  \param cell returned index of the cell along the axis
+  \param fraction returned position of the value in the cell (between 0 and 1)
+  \param size returned size of the cell
+  \return false if the value is outside of the grid
+*/
+//-----------------------------------------------------------------------------
+inline bool HardeningTable::getOctaveCell(int axis, double value, long &cell, double &fraction, double &size) const
+//-----------------------------------------------------------------------------
+{
+  unsigned long long bits;
+
+  if (!(value > 0.0))
+    return false;
+
+  // Exponent and mantissa of the value = 2^exponent (1 + mantissa)
+  std::memcpy(&bits, &value, sizeof(double));
+  int octave = int((bits >> 52) & 0x7ff) - 1023 - _minimumExponent[axis];
+  double mantissa = double(bits & 0xfffffffffffffULL) * (1.0 / 4503599627370496.0);
+
+  double position = mantissa * _pointsPerOctave[axis];
+  int subCell = int(position);
+  cell = long(octave) * _pointsPerOctave[axis] + subCell;
+  if ((octave < 0) || (cell >= _points[axis] - 1))
+    return false;
+
+  fraction = position - subCell;
+  size = value / ((1.0 + mantissa) * _pointsPerOctave[axis]);
+  return true;
+}
+
+/*!
+  \brief Interpolates the yield stress and its derivative
+
+  The derivative of the yield stress is the one used by the radial return, see HardeningLaw::getDerivateYieldStress():
+  \f[ h=\frac{\partial\sigma^y}{\partial\overline{\varepsilon^{p}}}+\frac{1}{\Delta t}\frac{\partial\sigma^y}{\partial\stackrel{\bullet}{\overline{\varepsilon^{p}}}}+\frac{\eta\sigma^y}{\rho C_p}\frac{\partial\sigma^y}{\partial T} \f]
+  \return false if the point is outside of the grid
+*/
+//-----------------------------------------------------------------------------
+inline bool HardeningTable::getYieldStress(double plasticStrain, double plasticStrainRate, double T, double dtime, double &yieldStress, double &derivateYieldStress) const
+//-----------------------------------------------------------------------------
+{
+  long cell[3] = {0, 0, 0};
+  double fraction[3] = {0.0, 0.0, 0.0};
+  double size[3] = {1.0, 1.0, 1.0};
+
+  if (!getOctaveCell(0, plasticStrain, cell[0], fraction[0], size[0]))
+    return false;
+
+  if ((_points[1] > 1) && !getOctaveCell(1, plasticStrainRate, cell[1], fraction[1], size[1]))
+    return false;
+
+  if (_points[2] > 1)
+  {
+    double position = (T - _minimumTemperature) / _temperatureStep;
+    if (!(position >= 0.0) || (position >= _points[2] - 1))
+      return false;
+    cell[2] = long(position);
+    fraction[2] = position - cell[2];
+    size[2] = _temperatureStep;
+  }
+
+  // Values at the corners of the cell
+  const double *c000 = _values + cell[0] * _stride[0] + cell[1] * _stride[1] + cell[2] * _stride[2];
+  const double *c010 = c000 + _stride[1];
+  const double *c001 = c000 + _stride[2];
+  const double *c011 = c010 + _stride[2];
+
+  // Interpolation along the plastic strain, and derivative
+  double v00 = c000[0] + fraction[0] * (c000[1] - c000[0]);
+  double v10 = c010[0] + fraction[0] * (c010[1] - c010[0]);
+  double v01 = c001[0] + fraction[0] * (c001[1] - c001[0]);
+  double v11 = c011[0] + fraction[0] * (c011[1] - c011[0]);
+  double d00 = c000[1] - c000[0];
+  double d10 = c010[1] - c010[0];
+  double d01 = c001[1] - c001[0];
+  double d11 = c011[1] - c011[0];
+
+  // Interpolation along the plastic strain rate, and derivatives
+  double v0 = v00 + fraction[1] * (v10 - v00);
+  double v1 = v01 + fraction[1] * (v11 - v01);
+  double d0 = d00 + fraction[1] * (d10 - d00);
+  double d1 = d01 + fraction[1] * (d11 - d01);
+  double r0 = v10 - v00;
+  double r1 = v11 - v01;
+
+  // Interpolation along the temperature, and derivatives
+  yieldStress = v0 + fraction[2] * (v1 - v0);
+  derivateYieldStress = (d0 + fraction[2] * (d1 - d0)) / size[0] + (v1 - v0) / size[2] * _thermalFactor * yieldStress;
+  if (_points[1] > 1)
+    derivateYieldStress += (r0 + fraction[2] * (r1 - r0)) / (size[1] * dtime);
+
+  return true;
+}
+
+#endif
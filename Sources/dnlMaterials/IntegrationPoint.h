@@ -24,9 +24,12 @@
 #define __dnlElements_IntegrationPoint_h__
 
 #include <dnlMaths.h>
+#include <List.h>
 
 struct IntegrationPointData;
 
+#define maxNumberOfNodes 10 //!< Maximum number of nodes for the elements
+
 /**Classe de gestion des donnees aux points d'integration.
 Cette classe sert à definir les donnees scalaires et tensorielles que l'on a au niveau de chaque point d'integration d'un element. Cette classe ne comporte pas de mecanismes de gestion ou de calcul, elle ne sert que de stockage de donnees (la classe "Element" et ses classes derivees dont elle depend gerent tous les calculs relatifs au modele d'integration).
 see Element
@@ -40,14 +43,14 @@ public:
   double detJ;                                      // Determinant du Jacobien
   double detJ0;                                     // Determinant du Jacobien de la configuration de reference
   double radius = 1;                                // Radius at the current integration point
-  Matrix dShapeFunction;                            // Matrice des derivees des fonctions d'interpolation par rapport aux coordonnees physiques
-  Matrix invJxW;                                    // Inverse du Jacobien de l'element au point d'integration
-  Matrix JxW;                                       // Jacobien de l'element au point d'integration
+  Mat<maxNumberOfNodes, 3> dShapeFunction;         // Matrice des derivees des fonctions d'interpolation par rapport aux coordonnees physiques
+  Mat<3, 3> invJxW;                                 // Inverse du Jacobien de l'element au point d'integration
+  Mat<3, 3> JxW;                                    // Jacobien de l'element au point d'integration
   Tensor2 R;                                        // Rotation tensor for the integration pount
   const IntegrationPointData *integrationPointData; // Data storage for the integration point data
 
 public:
-  IntegrationPointBase(int dimension, int numberOfNodes);
+  IntegrationPointBase();
   virtual ~IntegrationPointBase();
   virtual void flush() = 0;
   void baseFlush();
@@ -57,35 +60,96 @@ class UnderIntegrationPoint : public IntegrationPointBase
 {
 
 public:
-  UnderIntegrationPoint(int dimension, int numberOfNodes);
+  UnderIntegrationPoint();
   ~UnderIntegrationPoint();
   void flush();
 };
 
+class IntegrationPoint;
+
+/*!
+  \class IntegrationPointStore
+  \brief Contiguous storage of the state variables of the integration points
+
+  The state variables of all the integration points are stored field by field, one array per field, the state of an integration point being the element of each array given by the slot of the point. The slots are first given in the order of creation of the integration points. Once the elements have been dispatched on the cores, the store is laid out again in the order of the chunks and batches of elements, see reorder(), so that the radial return and the element kernels stream through each field.
+  \ingroup dnlElements
+*/
+class IntegrationPointStore
+{
+  long _size = 0;                    // Number of slots
+  long _capacity = 0;                // Number of allocated slots
+  IntegrationPoint **_owners = NULL; // Integration point of each slot, NULL for a released slot
+
+private:
+  void _allocate(long capacity);
+
+public:
+  double *yieldStress = NULL;           // parametre d'ecrouissage
+  double *plasticStrain = NULL;         // parametre d'ecrouissage
+  double *plasticStrainRate = NULL;     // parametre d'ecrouissage
+  double *pressure = NULL;              // partie spherique du tenseur des contraintes
+  double *gamma = NULL;                 // state variable for VUMAT gamma
+  double *gammaCumulate = NULL;         // state variable for VUMAT gamma
+  double *temperature = NULL;           // state variable for VUMAT temperature
+  double *internalEnergy = NULL;        //
+  double *inelasticEnergy = NULL;       //
+  double *density = NULL;               //
+  SymTensor2 *Strain = NULL;            // tenseur des deformations
+  SymTensor2 *StrainInc = NULL;         // increment du tenseur des deformations
+  SymTensor2 *PlasticStrain = NULL;     // tenseur des deformations plastiques
+  SymTensor2 *PlasticStrainInc = NULL;  // increment du tenseur des deformations plastiques
+  SymTensor2 *Stress = NULL;            // tenseur des contraintes
+
+public:
+  IntegrationPointStore() {}
+  ~IntegrationPointStore();
+
+  long getSize() const;
+  long newSlot(IntegrationPoint *point);
+  void releaseSlot(long slot);
+  void reorder(List<IntegrationPoint *> &points);
+};
+
+/*!
+  \class IntegrationPoint
+  \brief Integration point with its state variables
+
+  The state variables of the integration point are stored in the slot getSlot() of the store IntegrationPoint::store and accessed by the methods of the same name, see IntegrationPointStore.
+  \ingroup dnlElements
+*/
 class IntegrationPoint : public IntegrationPointBase
 {
+  friend class IntegrationPointStore;
+  long _slot; // Slot of the state variables in the store
 
 public:
-  double yieldStress = 0.0;       // parametre d'ecrouissage
-  double plasticStrain = 0.0;     // parametre d'ecrouissage
-  double plasticStrainRate = 0.0; // parametre d'ecrouissage
-  double pressure = 0.0;          // partie spherique du tenseur des contraintes
-  double gamma = 0.0;             // state variable for VUMAT gamma
-  double gammaCumulate = 0.0;     // state variable for VUMAT gamma
-  double temperature = 0.0;       // state variable for VUMAT temperature
-  double internalEnergy = 0.0;    //
-  double inelasticEnergy = 0.0;   //
-  double density;                 //
-  SymTensor2 Strain;              // tenseur des deformations
-  SymTensor2 StrainInc;           // increment du tenseur des deformations
-  SymTensor2 PlasticStrain;       // tenseur des deformations plastiques
-  SymTensor2 PlasticStrainInc;    // increment du tenseur des deformations plastiques
-  SymTensor2 Stress;              // tenseur des contraintes
+  static IntegrationPointStore store; // Storage of the state variables of all the integration points
 
 public:
-  IntegrationPoint(int dimension, int numberOfNodes);
+  IntegrationPoint();
   ~IntegrationPoint();
 
+#ifndef SWIG
+  IntegrationPoint(const IntegrationPoint &) = delete;
+  IntegrationPoint &operator=(const IntegrationPoint &) = delete;
+#endif
+
+  double &yieldStress() const;           // parametre d'ecrouissage
+  double &plasticStrain() const;         // parametre d'ecrouissage
+  double &plasticStrainRate() const;     // parametre d'ecrouissage
+  double &pressure() const;              // partie spherique du tenseur des contraintes
+  double &gamma() const;                 // state variable for VUMAT gamma
+  double &gammaCumulate() const;         // state variable for VUMAT gamma
+  double &temperature() const;           // state variable for VUMAT temperature
+  double &internalEnergy() const;        //
+  double &inelasticEnergy() const;       //
+  double &density() const;               //
+  SymTensor2 &Strain() const;            // tenseur des deformations
+  SymTensor2 &StrainInc() const;         // increment du tenseur des deformations
+  SymTensor2 &PlasticStrain() const;     // tenseur des deformations plastiques
+  SymTensor2 &PlasticStrainInc() const;  // increment du tenseur des deformations plastiques
+  SymTensor2 &Stress() const;            // tenseur des contraintes
+  long getSlot() const;
   void flush();
 
   // gestion des flux entree et sortie
@@ -99,4 +163,123 @@ public:
 #endif
 };
 
+//-----------------------------------------------------------------------------
+inline long IntegrationPointStore::getSize() const
+//-----------------------------------------------------------------------------
+{
+  return _size;
+}
+
+//-----------------------------------------------------------------------------
+inline long IntegrationPoint::getSlot() const
+//-----------------------------------------------------------------------------
+{
+  return _slot;
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::yieldStress() const
+//-----------------------------------------------------------------------------
+{
+  return store.yieldStress[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::plasticStrain() const
+//-----------------------------------------------------------------------------
+{
+  return store.plasticStrain[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::plasticStrainRate() const
+//-----------------------------------------------------------------------------
+{
+  return store.plasticStrainRate[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::pressure() const
+//-----------------------------------------------------------------------------
+{
+  return store.pressure[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::gamma() const
+//-----------------------------------------------------------------------------
+{
+  return store.gamma[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::gammaCumulate() const
+//-----------------------------------------------------------------------------
+{
+  return store.gammaCumulate[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::temperature() const
+//-----------------------------------------------------------------------------
+{
+  return store.temperature[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::internalEnergy() const
+//-----------------------------------------------------------------------------
+{
+  return store.internalEnergy[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::inelasticEnergy() const
+//-----------------------------------------------------------------------------
+{
+  return store.inelasticEnergy[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline double &IntegrationPoint::density() const
+//-----------------------------------------------------------------------------
+{
+  return store.density[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline SymTensor2 &IntegrationPoint::Strain() const
+//-----------------------------------------------------------------------------
+{
+  return store.Strain[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline SymTensor2 &IntegrationPoint::StrainInc() const
+//-----------------------------------------------------------------------------
+{
+  return store.StrainInc[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline SymTensor2 &IntegrationPoint::PlasticStrain() const
+//-----------------------------------------------------------------------------
+{
+  return store.PlasticStrain[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline SymTensor2 &IntegrationPoint::PlasticStrainInc() const
+//-----------------------------------------------------------------------------
+{
+  return store.PlasticStrainInc[_slot];
+}
+
+//-----------------------------------------------------------------------------
+inline SymTensor2 &IntegrationPoint::Stress() const
+//-----------------------------------------------------------------------------
+{
+  return store.Stress[_slot];
+}
+
 #endif
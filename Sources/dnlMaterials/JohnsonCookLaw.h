@@ -74,6 +74,7 @@ public:
   void setParameters(double A, double B, double C, double n, double m, double depsp0, double Tm, double T0);
   double getYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL);
   double getDerivateYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL);
+  void computeYieldStresses(int size, const double *plasticStrain, const double *plasticStrainRate, const double *T, double dtime, double *yieldStress, double *derivateYieldStress);
   double getNumericalDerivateYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL);
   double VUMATgetDerivateYieldStress(double plasticStrain, double plasticStrainRate = 0.0, double T = 0.0, double dtime = 0.0, IntegrationPoint *intPoint = NULL);
   double VUMATgetYieldStress(double plasticStrain, double plasticStrainRate, double temp);
@@ -75,6 +75,8 @@ public:
   double initialTemperature = 0.0;  // Reference temperature of the material  \f$T_{0}\f$
   double thermalConductivity = 0.0; // Thermal thermalConductivity of the material \f$\lambda}\f$
   double taylorQuinney = 0.0;       // Taylor-Quinney coefficient \f$\eta\f$ defining the amount of plastic work converted into heat energy
+  double hourglassViscosity = 0.1;  // Viscous hourglass control coefficient for the reduced integration elements
+  double hourglassStiffness = 0.0;  // Stiffness hourglass control coefficient for the reduced integration elements
 
 public:
   Material(char *newName = NULL);
@@ -25,6 +25,7 @@
 #include <ElasticLaw.h>
 #include <ElastoplasticLaw.h>
 #include <HardeningLaw.h>
+#include <HardeningTable.h>
 #include <IntegrationPoint.h>
 #include <JohnsonCookLaw.h>
 #include <Material.h>
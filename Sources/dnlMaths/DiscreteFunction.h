@@ -22,6 +22,7 @@
 #ifndef __dnlMaths_DiscreteFunction_h__
 #define __dnlMaths_DiscreteFunction_h__
 
+#include <atomic>
 #include <List.h>
 #include <Function.h>
 
@@ -33,20 +34,20 @@
 */
 class coupleReal
 {
-  friend class List<coupleReal *>;
+  friend class List<coupleReal>;
   friend class DiscreteFunction;
-  friend bool compare(coupleReal *t1, coupleReal *t2);
+  friend bool compare(const coupleReal t1, const coupleReal t2);
   double x; //!< Coordinate X of the point
   double y; //!< Coordinate Y of the point
 
   coupleReal();
   coupleReal(double x, double y);
-  coupleReal(const coupleReal &X);
-  ~coupleReal();
+  coupleReal(const coupleReal &X) = default;
+  ~coupleReal() = default;
 };
 
 // fonction de comparison pour le tri des points
-bool compare(coupleReal *t1, coupleReal *t2);
+bool compare(const coupleReal t1, const coupleReal t2);
 
 /*!
   \class DiscreteFunction
@@ -70,8 +71,11 @@ public:
   };
 
 protected:
-  List<coupleReal *> lpoints; //!< List of points
+  List<coupleReal> lpoints;   //!< List of points, stored contiguously
   bool Sort;                  //!< Boolean flage telling if the points are sorted or not
+  bool _uniform = false;      //!< Boolean flag telling if the points are regularly spaced along the X axis
+  double _inverseStep = 0.0;  //!< Inverse of the mean spacing of the points along the X axis
+  std::atomic<long> _lastInterval{0}; //!< Last interval found by getInterval(), used as a hint for the next search
 
 public:
   char style;  //!< First style variable for the discrete function. This is useful for storing information about this feature
@@ -79,6 +83,8 @@ public:
 
 private:
   void sort();
+  void updateSpacing(long first);
+  long getInterval(double abscissa);
 
 public:
   DiscreteFunction(char *newName = NULL);
@@ -167,6 +173,8 @@ inline void DiscreteFunction::flush()
 //-----------------------------------------------------------------------------
 {
   lpoints.flush();
+  _uniform = false;
+  _lastInterval.store(0, std::memory_order_relaxed);
 }
 
 /*!
@@ -177,7 +185,7 @@ inline void DiscreteFunction::flush()
 inline double DiscreteFunction::getXPoint(long point)
 //-----------------------------------------------------------------------------
 {
-  return lpoints(point)->x;
+  return lpoints(point).x;
 }
 
 /*!
@@ -188,7 +196,7 @@ inline double DiscreteFunction::getXPoint(long point)
 inline double DiscreteFunction::getYPoint(long point)
 //-----------------------------------------------------------------------------
 {
-  return lpoints(point)->y;
+  return lpoints(point).y;
 }
 
 #endif
@@ -0,0 +1,215 @@
+/***************************************************************************
+ *                                                                         *
+ *  DynELA Finite Element Code v 3.0                                       *
+ *  by Olivier PANTALE                                                     *
+ *                                                                         *
+ *  (c) Copyright 1997-2020                                                *
+ *                                                                         *
+ **************************************************************************/
+//@!CODEFILE = DynELA-H-file
+//@!BEGIN = PRIVATE
+
+/*!
+  \file Mat.h
+  \brief Declaration file for the fixed size matrix class
+
+  This file is the declaration file for the fixed size matrix class. The dimensions of the matrix are given as template parameters so that the data is stored inside the object without any dynamic allocation. This class is used for the small matrices of the elements (Jacobian, inverse of the Jacobian, derivatives of the shape functions).
+  \ingroup dnlMaths
+*/
+
+#ifndef __dnlMaths_Mat_h__
+#define __dnlMaths_Mat_h__
+
+#include <Matrix.h>
+
+/*!
+  \brief Declaration of the fixed size matrix class
+
+  The storage is row major as for the Matrix class. When the real size of the matrix is only known at runtime (number of nodes of an element), the template dimensions are the maximum values and only the upper left part of the matrix is used.
+  \ingroup dnlMaths
+*/
+template <int N, int M>
+class Mat
+{
+  double _data[N * M]; //!< Data storage for N x M double
+
+public:
+  Mat();
+  Mat(const Matrix &);
+
+  double operator()(int, int) const;
+  double &operator()(int, int);
+  Mat &operator=(const double);
+  Mat &operator=(const Matrix &);
+
+  double getDeterminant2x2() const;
+  double getDeterminant3x3() const;
+  int columns() const;
+  int rows() const;
+  void computeInverse2x2(double, Mat &) const;
+  void computeInverse3x3(double, Mat &) const;
+
+#ifndef SWIG
+  template <int P, int Q>
+  friend std::ostream &operator<<(std::ostream &, const Mat<P, Q> &);
+#endif
+};
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline Mat<N, M>::Mat()
+//-----------------------------------------------------------------------------
+{
+  for (int i = 0; i < N * M; i++)
+    _data[i] = 0.0;
+}
+
+// Recopie du contenu d'une matrice dynamique dans la partie superieure gauche
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline Mat<N, M>::Mat(const Matrix &mat)
+//-----------------------------------------------------------------------------
+{
+  *this = mat;
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline double Mat<N, M>::operator()(int i, int j) const
+//-----------------------------------------------------------------------------
+{
+#ifdef VERIF_maths
+  if ((i < 0) || (i >= N) || (j < 0) || (j >= M))
+    fatalError("Mat::operator()", "Index [%d,%d] is out of bounds [%d,%d]", i, j, N, M);
+#endif
+  return _data[Ind(i, j, N, M)];
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline double &Mat<N, M>::operator()(int i, int j)
+//-----------------------------------------------------------------------------
+{
+#ifdef VERIF_maths
+  if ((i < 0) || (i >= N) || (j < 0) || (j >= M))
+    fatalError("Mat::operator()", "Index [%d,%d] is out of bounds [%d,%d]", i, j, N, M);
+#endif
+  return _data[Ind(i, j, N, M)];
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline Mat<N, M> &Mat<N, M>::operator=(const double val)
+//-----------------------------------------------------------------------------
+{
+  for (int i = 0; i < N * M; i++)
+    _data[i] = val;
+  return *this;
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline Mat<N, M> &Mat<N, M>::operator=(const Matrix &mat)
+//-----------------------------------------------------------------------------
+{
+  if ((mat.rows() > N) || (mat.columns() > M))
+    fatalError("Mat::operator=", "Matrix [%d,%d] does not fit into a [%d,%d] matrix", mat.rows(), mat.columns(), N, M);
+
+  *this = 0.0;
+  for (int i = 0; i < mat.rows(); i++)
+    for (int j = 0; j < mat.columns(); j++)
+      _data[Ind(i, j, N, M)] = mat(i, j);
+  return *this;
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline int Mat<N, M>::rows() const
+//-----------------------------------------------------------------------------
+{
+  return N;
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline int Mat<N, M>::columns() const
+//-----------------------------------------------------------------------------
+{
+  return M;
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline double Mat<N, M>::getDeterminant2x2() const
+//-----------------------------------------------------------------------------
+{
+  return _data[Ind(0, 0, N, M)] * _data[Ind(1, 1, N, M)] - _data[Ind(1, 0, N, M)] * _data[Ind(0, 1, N, M)];
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline double Mat<N, M>::getDeterminant3x3() const
+//-----------------------------------------------------------------------------
+{
+  const Mat &A = *this;
+  return A(0, 1) * A(1, 2) * A(2, 0) -
+         A(0, 2) * A(1, 1) * A(2, 0) +
+         A(0, 2) * A(1, 0) * A(2, 1) -
+         A(0, 0) * A(1, 2) * A(2, 1) -
+         A(0, 1) * A(1, 0) * A(2, 2) +
+         A(0, 0) * A(1, 1) * A(2, 2);
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline void Mat<N, M>::computeInverse2x2(double det, Mat &inverse) const
+//-----------------------------------------------------------------------------
+{
+  const Mat &A = *this;
+  inverse(0, 0) = A(1, 1) / det;
+  inverse(0, 1) = -A(0, 1) / det;
+  inverse(1, 0) = -A(1, 0) / det;
+  inverse(1, 1) = A(0, 0) / det;
+}
+
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline void Mat<N, M>::computeInverse3x3(double det, Mat &inverse) const
+//-----------------------------------------------------------------------------
+{
+  const Mat &A = *this;
+  inverse(0, 0) = (A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1)) / det;
+  inverse(0, 1) = (A(0, 2) * A(2, 1) - A(0, 1) * A(2, 2)) / det;
+  inverse(0, 2) = (A(0, 1) * A(1, 2) - A(0, 2) * A(1, 1)) / det;
+  inverse(1, 0) = (A(1, 2) * A(2, 0) - A(1, 0) * A(2, 2)) / det;
+  inverse(1, 1) = (A(0, 0) * A(2, 2) - A(0, 2) * A(2, 0)) / det;
+  inverse(1, 2) = (A(0, 2) * A(1, 0) - A(0, 0) * A(1, 2)) / det;
+  inverse(2, 0) = (A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0)) / det;
+  inverse(2, 1) = (A(0, 1) * A(2, 0) - A(0, 0) * A(2, 1)) / det;
+  inverse(2, 2) = (A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0)) / det;
+}
+
+#ifndef SWIG
+//-----------------------------------------------------------------------------
+template <int N, int M>
+inline std::ostream &operator<<(std::ostream &os, const Mat<N, M> &mat)
+//-----------------------------------------------------------------------------
+{
+  os << "matrix " << N << "x" << M << " ={{";
+  for (int i = 0; i < N; i++)
+  {
+    for (int j = 0; j < M; j++)
+    {
+      if (j != 0)
+        os << ",";
+      os << mat(i, j);
+    }
+    if (i != N - 1)
+      os << "},{";
+  }
+  os << "}}";
+  return os;
+}
+#endif
+
+#endif
@@ -115,12 +115,18 @@ public:
   Vec3D getRow(short) const;
   Vec3D rowSum() const;
   Vec3D solve(const Vec3D &) const;
+  void hughesWinget(SymTensor2 &, Tensor2 &) const;
   void numpyRead(std::string);
   void numpyReadZ(std::string, std::string);
   void numpyWrite(std::string, bool = false) const;
   void numpyWriteZ(std::string, std::string, bool = false) const;
   void polarDecompose(SymTensor2 &, Tensor2 &) const;
   void polarDecomposeLnU(SymTensor2 &, Tensor2 &) const;
+  void polarDecomposeLnUJacobi(SymTensor2 &, Tensor2 &) const;
+#ifndef SWIG
+  static void hughesWinget(int, const Tensor2 *, SymTensor2 *, Tensor2 *);
+  static void polarDecomposeLnU(int, const Tensor2 *, SymTensor2 *, Tensor2 *, bool = false);
+#endif
   void setToUnity();
   void setToValue(const double);
   void setToZero();
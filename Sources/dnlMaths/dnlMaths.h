@@ -24,6 +24,7 @@
 #include <DiscreteFunction.h>
 #include <DiscreteFunctionSet.h>
 #include <Function.h>
+#include <Mat.h>
 #include <Matrices.h>
 #include <Matrix.h>
 #include <MatrixDiag.h>